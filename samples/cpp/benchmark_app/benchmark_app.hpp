@@ -115,6 +115,18 @@ static const char infer_num_streams_message[] =
 static const char infer_requests_count_message[] =
     "Optional. Number of infer requests. Default value is determined automatically for device.";
 
+/// @brief message for open-loop request rate
+static const char target_qps_message[] =
+    "Optional. Generate inference requests open-loop at the given rate (inferences per second) instead of "
+    "keeping all requests busy. Latency of a request is then measured from its scheduled arrival moment, so "
+    "the time spent waiting for a free infer request counts towards it, which matches what an external "
+    "client observes under load. Requires -api async. Default value is 0 (closed-loop).";
+
+/// @brief message for open-loop arrival process
+static const char arrival_message[] =
+    "Optional. Arrival process for the open-loop mode (-qps): \"fixed\" for equally spaced requests or "
+    "\"poisson\" for exponentially distributed inter-arrival times. Default value is \"fixed\".";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -313,6 +325,12 @@ DEFINE_string(api, "async", api_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint64(nireq, 0, infer_requests_count_message);
 
+/// @brief Target request rate for the open-loop mode (default 0 - closed-loop)
+DEFINE_double(qps, 0., target_qps_message);
+
+/// @brief Arrival process for the open-loop mode
+DEFINE_string(arrival, "fixed", arrival_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -411,6 +429,8 @@ static void show_usage() {
     std::cout << "    -load_from_file               " << load_from_file_message << std::endl;
     std::cout << "    -api <sync/async>             " << api_message << std::endl;
     std::cout << "    -nireq  <integer>             " << infer_requests_count_message << std::endl;
+    std::cout << "    -qps  <float>                 " << target_qps_message << std::endl;
+    std::cout << "    -arrival <fixed/poisson>      " << arrival_message << std::endl;
     std::cout << "    -nstreams  <integer>          " << infer_num_streams_message << std::endl;
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
     std::cout << "    -infer_precision        " << inference_precision_message << std::endl;
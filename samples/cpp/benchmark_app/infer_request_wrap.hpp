@@ -50,6 +50,13 @@ public:
         _request.start_async();
     }
 
+    // Open-loop mode: latency is measured from the scheduled arrival moment, so the time the
+    // request spent waiting for a free slot counts towards it, as an external client would see
+    void start_async_scheduled(Time::time_point scheduledTime) {
+        _startTime = scheduledTime;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
@@ -6,7 +6,9 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -53,6 +55,15 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Target request rate can't be negative. Please set -qps option to a positive value.");
+    }
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode drives requests asynchronously. -qps requires -api async.");
+    }
+    if (FLAGS_arrival != "fixed" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `fixed` or `poisson` value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -1098,6 +1109,15 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        // Open-loop generation state: requests are issued at externally scheduled arrival
+        // moments instead of as soon as a request frees up, so queueing shows up in latency
+        const bool openLoop = FLAGS_qps > 0;
+        std::mt19937_64 arrivalGen(0);
+        std::exponential_distribution<double> poissonInterval(FLAGS_qps);
+        const auto fixedInterval =
+            openLoop ? std::chrono::duration_cast<ns>(std::chrono::duration<double>(1. / FLAGS_qps)) : ns(0);
+        auto nextArrival = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
@@ -1137,6 +1157,13 @@ int main(int argc, char* argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (openLoop) {
+                std::this_thread::sleep_until(nextArrival);
+                inferRequest->start_async_scheduled(nextArrival);
+                nextArrival += FLAGS_arrival == "poisson"
+                                   ? std::chrono::duration_cast<ns>(
+                                         std::chrono::duration<double>(poissonInterval(arrivalGen)))
+                                   : fixedInterval;
             } else {
                 inferRequest->start_async();
             }
@@ -1170,6 +1197,20 @@ int main(int argc, char* argv[]) {
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = 1000.0 * processedFramesN / totalDuration;
 
+        std::vector<std::pair<std::string, double>> openLoopPercentiles;
+        if (openLoop) {
+            auto sortedLatencies = inferRequestsQueue.get_latencies();
+            std::sort(sortedLatencies.begin(), sortedLatencies.end());
+            auto percentile = [&sortedLatencies](double boundary) {
+                const auto index = static_cast<size_t>(sortedLatencies.size() * boundary / 100.);
+                return sortedLatencies[std::min(index, sortedLatencies.size() - 1)];
+            };
+            openLoopPercentiles = {{"p50", percentile(50.)},
+                                   {"p95", percentile(95.)},
+                                   {"p99", percentile(99.)},
+                                   {"p99.9", percentile(99.9)}};
+        }
+
         if (statistics) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("total execution time (ms)", "execution_time", totalDuration),
@@ -1189,6 +1230,15 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
 
+                for (const auto& percentile : openLoopPercentiles) {
+                    statistics->add_parameters(
+                        StatisticsReport::Category::EXECUTION_RESULTS,
+                        {StatisticsVariant("Latency " + percentile.first + " (ms)",
+                                           "latency_" + std::string(percentile.first == "p99.9" ? "p999"
+                                                                                                : percentile.first),
+                                           percentile.second)});
+                }
+
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
                         statistics->add_parameters(
@@ -1257,6 +1307,15 @@ int main(int argc, char* argv[]) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
 
+            if (openLoop) {
+                slog::info << "Open-loop latency percentiles (" << FLAGS_arrival << " arrivals at "
+                           << double_to_string(FLAGS_qps) << " QPS):" << slog::endl;
+                for (const auto& percentile : openLoopPercentiles) {
+                    slog::info << "   " << percentile.first << ":     " << double_to_string(percentile.second) << " ms"
+                               << slog::endl;
+                }
+            }
+
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
                 for (size_t i = 0; i < app_inputs_info.size(); ++i) {
@@ -314,3 +314,71 @@ ov_infer_request_get_profiling_info(const ov_infer_request_t* infer_request, ov_
  */
 OPENVINO_C_API(void)
 ov_profiling_info_list_free(ov_profiling_info_list_t* profiling_infos);
+
+/**
+ * @struct ov_completion_queue_t
+ * @ingroup ov_infer_request_c_api
+ * @brief A queue collecting finished asynchronous infer requests, so an event loop can dequeue
+ * completions of many requests in batches from a single call instead of blocking a thread per request.
+ */
+typedef struct ov_completion_queue ov_completion_queue_t;
+
+/**
+ * @struct ov_completion_t
+ * @ingroup ov_infer_request_c_api
+ * @brief A record of one finished asynchronous inference
+ */
+typedef struct {
+    ov_infer_request_t* infer_request;  //!< The infer request that finished
+    void* userdata;                     //!< The userdata passed on submit
+    ov_status_e status;                 //!< Status of the inference: OK(0) for success
+} ov_completion_t;
+
+/**
+ * @brief Create a completion queue.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the newly created ov_completion_queue_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_completion_queue_create(ov_completion_queue_t** queue);
+
+/**
+ * @brief Start inference of a request in asynchronous mode and report its completion to the queue.
+ * @note Replaces the callback of the request; the queue must outlive all requests submitted to it.
+ * Any number of requests, also from different compiled models, may be in flight on one queue.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the ov_completion_queue_t.
+ * @param infer_request A pointer to the ov_infer_request_t to start.
+ * @param userdata Any data to be returned with the completion of this inference.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_completion_queue_submit(ov_completion_queue_t* queue, ov_infer_request_t* infer_request, void* userdata);
+
+/**
+ * @brief Dequeue a batch of completions, waiting when none are available yet.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the ov_completion_queue_t.
+ * @param completions An array of at least @p capacity elements to be filled with completion records.
+ * @param capacity Maximum number of completions to dequeue.
+ * @param timeout Maximum duration, in milliseconds, to block for when the queue is empty: 0 returns
+ * immediately, a negative value waits without a timeout.
+ * @param num A pointer to receive the number of dequeued completions; 0 when the timeout elapsed.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_completion_queue_dequeue(ov_completion_queue_t* queue,
+                            ov_completion_t* completions,
+                            const size_t capacity,
+                            const int64_t timeout,
+                            size_t* num);
+
+/**
+ * @brief Release the memory allocated by ov_completion_queue_t.
+ * @note Make sure no submitted request is still running and no thread is blocked in dequeue.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the ov_completion_queue_t to free memory.
+ */
+OPENVINO_C_API(void)
+ov_completion_queue_free(ov_completion_queue_t* queue);
@@ -3,6 +3,11 @@
 //
 #include "openvino/c/ov_infer_request.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
 #include "common.h"
 
 void ov_infer_request_free(ov_infer_request_t* infer_request) {
@@ -358,3 +363,93 @@ void ov_profiling_info_list_free(ov_profiling_info_list_t* profiling_infos) {
     profiling_infos->profiling_infos = nullptr;
     profiling_infos->size = 0;
 }
+
+struct ov_completion_queue {
+    std::mutex m;
+    std::condition_variable cv;
+    std::deque<ov_completion_t> completions;
+};
+
+namespace {
+ov_status_e exception_to_status(std::exception_ptr ex) {
+    if (!ex) {
+        return ov_status_e::OK;
+    }
+    try {
+        std::rethrow_exception(ex);
+    }
+    CATCH_OV_EXCEPTIONS
+}
+}  // namespace
+
+ov_status_e ov_completion_queue_create(ov_completion_queue_t** queue) {
+    if (!queue) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        *queue = new ov_completion_queue;
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_completion_queue_submit(ov_completion_queue_t* queue,
+                                       ov_infer_request_t* infer_request,
+                                       void* userdata) {
+    if (!queue || !infer_request) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        infer_request->object->set_callback([queue, infer_request, userdata](std::exception_ptr ex) {
+            ov_completion_t completion{infer_request, userdata, exception_to_status(ex)};
+            {
+                std::lock_guard<std::mutex> lock(queue->m);
+                queue->completions.push_back(completion);
+            }
+            queue->cv.notify_one();
+        });
+        infer_request->object->start_async();
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_completion_queue_dequeue(ov_completion_queue_t* queue,
+                                        ov_completion_t* completions,
+                                        const size_t capacity,
+                                        const int64_t timeout,
+                                        size_t* num) {
+    if (!queue || !completions || capacity == 0 || !num) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::unique_lock<std::mutex> lock(queue->m);
+        auto not_empty = [queue] {
+            return !queue->completions.empty();
+        };
+        if (timeout < 0) {
+            queue->cv.wait(lock, not_empty);
+        } else if (timeout > 0) {
+            queue->cv.wait_for(lock, std::chrono::milliseconds(timeout), not_empty);
+        }
+        size_t count = 0;
+        while (count < capacity && !queue->completions.empty()) {
+            completions[count++] = queue->completions.front();
+            queue->completions.pop_front();
+        }
+        *num = count;
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+void ov_completion_queue_free(ov_completion_queue_t* queue) {
+    if (queue)
+        delete queue;
+}
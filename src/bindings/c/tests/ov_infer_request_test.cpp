@@ -387,6 +387,34 @@ TEST_P(ov_infer_request_test, infer_request_set_callback) {
     }
 }
 
+TEST_P(ov_infer_request_test, infer_request_completion_queue) {
+    OV_EXPECT_OK(ov_infer_request_set_input_tensor_by_index(infer_request, 0, input_tensor));
+
+    ov_completion_queue_t* queue = nullptr;
+    OV_ASSERT_OK(ov_completion_queue_create(&queue));
+    EXPECT_NE(nullptr, queue);
+
+    int userdata = 42;
+    OV_ASSERT_OK(ov_completion_queue_submit(queue, infer_request, &userdata));
+
+    ov_completion_t completions[4];
+    size_t num = 0;
+    OV_EXPECT_OK(ov_completion_queue_dequeue(queue, completions, 4, -1, &num));
+    EXPECT_EQ(1, num);
+    EXPECT_EQ(infer_request, completions[0].infer_request);
+    EXPECT_EQ(&userdata, completions[0].userdata);
+    EXPECT_EQ(ov_status_e::OK, completions[0].status);
+
+    // an empty queue with a zero timeout returns immediately with no completions
+    OV_EXPECT_OK(ov_completion_queue_dequeue(queue, completions, 4, 0, &num));
+    EXPECT_EQ(0, num);
+
+    OV_EXPECT_OK(ov_infer_request_get_output_tensor_by_index(infer_request, 0, &output_tensor));
+    EXPECT_NE(nullptr, output_tensor);
+
+    ov_completion_queue_free(queue);
+}
+
 TEST_P(ov_infer_request_test, get_profiling_info) {
     auto device_name = GetParam();
     OV_EXPECT_OK(ov_infer_request_set_tensor(infer_request, in_tensor_name, input_tensor));
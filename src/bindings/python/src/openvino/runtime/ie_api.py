@@ -70,7 +70,15 @@ class InferRequest(_InferRequestWrapper):
         :type shared_memory: bool, optional
         :return: Dictionary of results from output tensors with port/int/str keys.
         :rtype: OVDict
+
+        For the lowest per-call overhead bind the I/O once instead of passing it here:
+        wrap each numpy array into `Tensor(array, shared_memory=True)`, set it with
+        `set_input_tensor`/`set_tensor` and call `infer()` without arguments. Data
+        dispatching is then skipped entirely and the GIL is released for the whole
+        inference, so the binding adds no per-call conversion work.
         """
+        if inputs is None:
+            return OVDict(super().infer({}))
         return OVDict(super().infer(_data_dispatch(
             self,
             inputs,
@@ -129,6 +137,9 @@ class InferRequest(_InferRequestWrapper):
                               Default value: False
         :type shared_memory: bool, optional
         """
+        if inputs is None:
+            super().start_async({}, userdata)
+            return
         super().start_async(
             _data_dispatch(
                 self,
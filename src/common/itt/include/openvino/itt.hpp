@@ -47,6 +47,7 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            void dumpTrace(const char* path);
         }
         /**
          * @endcond
@@ -68,6 +69,26 @@ namespace openvino
             internal::threadName(name.c_str());
         }
 
+        /**
+         * @fn void dumpTrace(const char* path)
+         * @ingroup ov_dev_profiling
+         * @brief Dump the built-in flight recorder rings to a chrome://tracing JSON file.
+         * @details The recorder keeps the tail of the annotated task stream in per-thread
+         *          ring buffers when the OPENVINO_TRACE_RING environment variable is set;
+         *          besides the automatic dump at process exit, this call snapshots the rings
+         *          at any point of interest. No-op when the recorder is disabled.
+         * @param path [in] The output file path
+         */
+        inline void dumpTrace(const char* path)
+        {
+            internal::dumpTrace(path);
+        }
+
+        inline void dumpTrace(const std::string &path)
+        {
+            internal::dumpTrace(path.c_str());
+        }
+
         inline handle_t handle(char const *name)
         {
             return internal::handle(name);
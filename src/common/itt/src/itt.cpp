@@ -8,6 +8,14 @@
 
 #ifdef ENABLE_PROFILING_ITT
 #    include <ittnotify.h>
+
+#    include <atomic>
+#    include <chrono>
+#    include <fstream>
+#    include <memory>
+#    include <mutex>
+#    include <unordered_map>
+#    include <vector>
 #endif
 
 namespace openvino {
@@ -24,25 +32,171 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+// Built-in flight recorder: captures task begin/end events into fixed-size per-thread ring
+// buffers, so only the tail of the event stream is kept and the steady-state overhead is a
+// single timestamp read and two stores per event, with no collector process attached.
+// Enabled with OPENVINO_TRACE_RING=<path>; the buffers are dumped in chrome://tracing JSON
+// format to <path> at process exit (or on an explicit dumpTrace() call). The ring capacity
+// in events per thread is controlled with OPENVINO_TRACE_RING_SIZE (default 8192).
+class FlightRecorder {
+    struct Event {
+        std::chrono::steady_clock::time_point timestamp;
+        handle_t handle;  // nullptr marks a task end
+    };
+
+    struct ThreadBuffer {
+        std::vector<Event> events;
+        // written only by the owning thread; the release store in record() publishes the event
+        // slot filled right before it, so dump() on another thread may read every slot below next
+        std::atomic<size_t> next{0};
+        std::atomic<bool> wrapped{false};
+        uint32_t tid = 0;
+    };
+
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+    std::unordered_map<handle_t, std::string> m_names;
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+    const char* m_path = std::getenv("OPENVINO_TRACE_RING");
+    size_t m_capacity = 8192;
+
+    FlightRecorder() {
+        if (const char* size = std::getenv("OPENVINO_TRACE_RING_SIZE")) {
+            const size_t value = std::strtoul(size, nullptr, 10);
+            if (value)
+                m_capacity = value;
+        }
+    }
+
+    ~FlightRecorder() {
+        if (enabled())
+            dump(m_path);
+    }
+
+    ThreadBuffer& buffer() {
+        static thread_local std::shared_ptr<ThreadBuffer> tl_buffer;
+        if (!tl_buffer) {
+            tl_buffer = std::make_shared<ThreadBuffer>();
+            tl_buffer->events.resize(m_capacity);
+            std::lock_guard<std::mutex> lock{m_mutex};
+            tl_buffer->tid = static_cast<uint32_t>(m_buffers.size());
+            m_buffers.push_back(tl_buffer);  // keeps the buffer alive after the thread exits
+        }
+        return *tl_buffer;
+    }
+
+    static void writeEscaped(std::ostream& os, const std::string& str) {
+        for (char c : str) {
+            if (c == '"' || c == '\\')
+                os << '\\';
+            os << c;
+        }
+    }
+
+public:
+    static FlightRecorder& get() {
+        static FlightRecorder instance;
+        return instance;
+    }
+
+    bool enabled() const {
+        return m_path != nullptr;
+    }
+
+    void record(handle_t h) {
+        auto& buf = buffer();
+        const size_t slot = buf.next.load(std::memory_order_relaxed);
+        buf.events[slot] = {std::chrono::steady_clock::now(), h};
+        size_t next = slot + 1;
+        if (next == buf.events.size()) {
+            next = 0;
+            buf.wrapped.store(true, std::memory_order_relaxed);
+        }
+        buf.next.store(next, std::memory_order_release);
+    }
+
+    void registerHandle(handle_t h, const char* name) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_names.emplace(h, name);
+    }
+
+    void dump(const char* path) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        std::ofstream os(path);
+        if (!os)
+            return;
+        os << "{\"traceEvents\":[";
+        bool first = true;
+        for (const auto& buf : m_buffers) {
+            // Replay the ring from the oldest retained event; ends whose begins were
+            // overwritten are skipped to keep the B/E nesting consistent per thread.
+            // The acquire pairs with the release in record() so every slot below next is
+            // fully written. In a wrapped ring the slot at next is the one a live owner
+            // overwrites next, so it is skipped: at most one in-flight event is dropped.
+            const size_t next = buf->next.load(std::memory_order_acquire);
+            const bool wrapped = buf->wrapped.load(std::memory_order_relaxed);
+            const size_t size = wrapped ? buf->events.size() - 1 : next;
+            const size_t begin = wrapped ? next + 1 : 0;
+            size_t depth = 0;
+            for (size_t i = 0; i < size; ++i) {
+                const auto& event = buf->events[(begin + i) % buf->events.size()];
+                if (!event.handle && !depth)
+                    continue;
+                const auto ts =
+                    std::chrono::duration_cast<std::chrono::microseconds>(event.timestamp - m_start).count();
+                if (!first)
+                    os << ',';
+                first = false;
+                if (event.handle) {
+                    ++depth;
+                    os << "{\"ph\":\"B\",\"name\":\"";
+                    const auto it = m_names.find(event.handle);
+                    writeEscaped(os, it != m_names.end() ? it->second : "unknown");
+                    os << "\",";
+                } else {
+                    --depth;
+                    os << "{\"ph\":\"E\",";
+                }
+                os << "\"pid\":0,\"tid\":" << buf->tid << ",\"ts\":" << ts << "}";
+            }
+        }
+        os << "]}\n";
+    }
+};
+
 domain_t domain(char const* name) {
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
 
 handle_t handle(char const* name) {
-    return reinterpret_cast<handle_t>(__itt_string_handle_create(name));
+    auto h = reinterpret_cast<handle_t>(__itt_string_handle_create(name));
+    if (FlightRecorder::get().enabled())
+        FlightRecorder::get().registerHandle(h, name);
+    return h;
 }
 
 void taskBegin(domain_t d, handle_t t) {
-    if (!callStackDepth() || call_stack_depth++ < callStackDepth())
+    if (!callStackDepth() || call_stack_depth++ < callStackDepth()) {
+        if (FlightRecorder::get().enabled())
+            FlightRecorder::get().record(t);
         __itt_task_begin(reinterpret_cast<__itt_domain*>(d),
                          __itt_null,
                          __itt_null,
                          reinterpret_cast<__itt_string_handle*>(t));
+    }
 }
 
 void taskEnd(domain_t d) {
-    if (!callStackDepth() || --call_stack_depth < callStackDepth())
+    if (!callStackDepth() || --call_stack_depth < callStackDepth()) {
+        if (FlightRecorder::get().enabled())
+            FlightRecorder::get().record(nullptr);
         __itt_task_end(reinterpret_cast<__itt_domain*>(d));
+    }
+}
+
+void dumpTrace(const char* path) {
+    if (FlightRecorder::get().enabled())
+        FlightRecorder::get().dump(path);
 }
 
 void threadName(const char* name) {
@@ -65,6 +219,8 @@ void taskEnd(domain_t) {}
 
 void threadName(const char*) {}
 
+void dumpTrace(const char*) {}
+
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
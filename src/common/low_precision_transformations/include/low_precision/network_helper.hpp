@@ -198,6 +198,11 @@ public:
 
     static std::shared_ptr<Node> toScalarIfPossible(std::shared_ptr<Node> node);
 
+    // The folded weights are recomputed on every compilation on purpose: persisting them is the job
+    // of the compiled-model cache (ov::cache_dir), which stores the plugin blob produced after LPT
+    // and skips the whole pipeline including this folding on a hit. A separate content-addressed
+    // store for quantized weights would only help on cache misses with unchanged weights and would
+    // duplicate the cache invalidation logic.
     static std::shared_ptr<Node> fold_fake_quantize(const std::shared_ptr<opset1::FakeQuantize>& fq);
     static std::shared_ptr<Node> fold_fake_quantize(const std::shared_ptr<opset1::FakeQuantize>& fq, const bool roundValues);
 
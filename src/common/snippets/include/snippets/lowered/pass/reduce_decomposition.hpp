@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "pass.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+/**
+ * @interface ReduceDecomposition
+ * @brief Decomposes snippets ReduceMax and ReduceSum to a range of low-level operations on linear IR
+ *        so the reduction is accumulated in a vector register and finalized with a horizontal operation
+ * @ingroup snippets
+ */
+class ReduceDecomposition : public Pass {
+public:
+    explicit ReduceDecomposition(size_t vector_size);
+    OPENVINO_RTTI("ReduceDecomposition", "Pass")
+    bool run(LinearIR& linear_ir) override;
+
+private:
+    size_t m_vector_size;
+};
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
@@ -0,0 +1,28 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ReduceToSnippetsReduce
+ * @brief Converts ReduceMax and ReduceSum from the opset to the snippets counterparts with the axis
+ *        stored as an attribute and updates port descriptors in accordance with the reduction axis.
+ *        The axes input is folded into the operation, so it isn't turned into a Scalar later on
+ * @ingroup snippets
+ */
+class ReduceToSnippetsReduce: public ov::pass::MatcherPass {
+public:
+    ReduceToSnippetsReduce();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ov
@@ -0,0 +1,131 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
+
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/lowered/loop_manager.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/snippets_isa.hpp"
+#include "snippets/itt.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+namespace {
+
+uint32_t get_initial_value(const std::shared_ptr<const Node>& reduce) {
+    // Initial values that are neutral for the accumulation: -FLT_MAX for Max, 0 for Sum.
+    // The same values fill the unused vector register lanes in the tail loop
+    if (ov::is_type<op::ReduceMax>(reduce))
+        return uint32_t(0xff7fffff);
+    if (ov::is_type<op::ReduceSum>(reduce))
+        return uint32_t(0x00000000);
+    OPENVINO_THROW("get_initial_value expects ReduceMax or ReduceSum");
+}
+
+} // namespace
+
+ReduceDecomposition::ReduceDecomposition(size_t vector_size) : m_vector_size{vector_size} {}
+
+bool ReduceDecomposition::run(LinearIR& linear_ir) {
+    OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::ReduceDecompositionLowered")
+    bool modified = false;
+    const auto& loop_manager = linear_ir.get_loop_manager();
+
+    for (auto expr_it = linear_ir.begin(); expr_it != linear_ir.end(); expr_it++) {
+        const auto& reduce = ov::as_type_ptr<op::ReduceBase>((*expr_it)->get_node());
+        if (!reduce)
+            continue;
+        const auto reduce_expr = *expr_it;
+        const auto reduce_loop_ids = reduce_expr->get_loop_ids();
+        const auto& input_connector = reduce_expr->get_input_port_connector(0);
+        const auto& output_connector = reduce_expr->get_output_port_connector(0);
+        const auto tensor_in = reduce_expr->get_input_port_descriptor(0)->get_shape();
+        const auto inner_work_amount = *(tensor_in.rbegin());
+        // Only the innermost dimension is reduced in a register, outer reductions keep the Reduce op
+        if (reduce->get_axis() != tensor_in.size() - 1)
+            continue;
+        const auto is_max = ov::is_type<op::ReduceMax>(reduce);
+        const auto fill_value = get_initial_value(reduce);
+
+        expr_it = linear_ir.erase(expr_it);   // Remove Reduce
+
+        std::vector<ExpressionPtr> outer_exprs;
+
+        // We need an iterator to the inserted element
+        auto push_node = [&linear_ir, &expr_it, &reduce_loop_ids](const std::shared_ptr<Node>& n) {
+            const auto expr = linear_ir.insert(expr_it, n);
+            (*expr)->set_loop_ids(reduce_loop_ids);
+            return std::make_pair(expr, n);
+        };
+
+        // Note: VectorBuffer is a special case, since it should go before the initial Load. So we handle it separately
+        const auto& vector_buffer = push_node(std::make_shared<op::VectorBuffer>());
+        outer_exprs.push_back(*vector_buffer.first);
+
+        // Accumulation loop
+        const auto& accumulation = is_max
+            ? push_node(std::make_shared<ov::op::v1::Maximum>(reduce->get_input_source_output(0), vector_buffer.second))
+            : push_node(std::make_shared<ov::op::v1::Add>(reduce->get_input_source_output(0), vector_buffer.second));
+
+        const auto& horizon = is_max
+            ? push_node(std::make_shared<op::HorizonMax>(accumulation.second))
+            : push_node(std::make_shared<op::HorizonSum>(accumulation.second));
+        outer_exprs.push_back(*horizon.first);
+
+        // Markup of the accumulation Loop
+        loop_manager->mark_loop(accumulation.first, horizon.first, 1, inner_work_amount, m_vector_size,
+                                std::vector<ExpressionPort>{(*accumulation.first)->get_input_port(0),
+                                                            (*accumulation.first)->get_input_port(1)},
+                                std::vector<ExpressionPort>{(*accumulation.first)->get_output_port(0)});
+
+        // Transfer original ExpressionPorts
+        linear_ir.replace_input((*accumulation.first)->get_input_port(0), input_connector);
+        linear_ir.replace_input(output_connector->get_consumers(), (*horizon.first)->get_output_port_connector(0));
+
+        // Markup inner loop for outside expression with null loop id
+        for (const auto& expr : outer_exprs) {
+            expr->set_loop_id(Expression::LOOP_NULL_ID, 1);
+        }
+
+        auto update_loop_bounds = [&reduce_expr](std::vector<ExpressionPort>& points,
+                                                 const std::vector<ExpressionPort>& new_points,
+                                                 const LinearIR::LoopManager::LoopInfoPtr& loop_info) {
+            auto entry_found = std::find_if(points.begin(), points.end(), [&reduce_expr](const ExpressionPort& desc) {
+                return desc.get_expr() == reduce_expr;
+            });
+            if (entry_found != points.end()) {
+                entry_found = points.erase(entry_found);
+                points.insert(entry_found, new_points.begin(), new_points.end());
+            }
+        };
+
+        // Update Loop info for outer loops
+        for (auto loop_id : reduce_loop_ids) {
+            if (loop_id == Expression::LOOP_NULL_ID)
+                continue;
+            const auto loop_info = loop_manager->get_loop_info(loop_id);
+            update_loop_bounds(loop_info->entry_exprs,
+                               std::vector<ExpressionPort>{(*accumulation.first)->get_input_port(0)}, loop_info);
+            update_loop_bounds(loop_info->exit_exprs,
+                               std::vector<ExpressionPort>{(*horizon.first)->get_output_port(0)}, loop_info);
+        }
+
+        // For the tail loop the unused lanes of the accumulator input should be filled with
+        // the neutral value of the reduction to keep the math correct
+        // TODO [111383]: It should be covered via general pipeline (for example, via analyze in InsertTailLoop?)
+        accumulation.second->input(0).get_rt_info()["set_fill"] = fill_value;
+        modified = true;
+    }
+
+    return modified;
+}
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
@@ -18,6 +18,7 @@
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
 #include "snippets/pass/set_softmax_ports.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 
 #include "snippets/utils.hpp"
 
@@ -34,6 +35,7 @@
 #include "snippets/lowered/pass/propagate_layout.hpp"
 #include "snippets/lowered/pass/cleanup_loop_offsets.hpp"
 #include "snippets/lowered/pass/softmax_decomposition.hpp"
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
 #include "snippets/lowered/pass/move_scalar_to_consumer.hpp"
 #include "snippets/lowered/pass/move_result_out_of_loop.hpp"
 #include "snippets/lowered/pass/clean_repeated_ptr_shifts.hpp"
@@ -69,6 +71,8 @@ auto snippets::op::Subgraph::is_domain_sensitive_op(const std::shared_ptr<ov::No
            ov::is_type<ov::op::v1::Softmax>(op) ||
            ov::is_type<ov::op::v8::Softmax>(op) ||
            ov::is_type<ov::op::v0::MatMul>(op) ||
+           ov::is_type<ov::op::v1::ReduceMax>(op) ||
+           ov::is_type<ov::op::v1::ReduceSum>(op) ||
            ov::is_type<ov::op::v1::Broadcast>(op) || // Broadcast is domain sensetive op because the output shape depends on
            ov::is_type<ov::op::v3::Broadcast>(op);   // the both input and broadcast shapes (the both - are inputs of op). Note: is used only in MHA pattern
 }
@@ -116,6 +120,12 @@ auto snippets::op::Subgraph::get_estimated_buffer_count(const ov::NodeVector& op
             if (used_precision_size.empty() || used_precision_size.back() != prc_size) {
                 used_precision_size.push_back(prc_size);
             }
+        } else if (ov::is_type<ov::op::v1::ReduceMax>(op) || ov::is_type<ov::op::v1::ReduceSum>(op)) {
+            // After the decomposition the reduction loop is separated from its consumers by a Buffer (always FP32)
+            const auto prc_size = ov::element::f32.size();
+            if (used_precision_size.empty() || used_precision_size.back() != prc_size) {
+                used_precision_size.push_back(prc_size);
+            }
         } else if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(op)) {
             // First input check is enough because MatMul requires the same prc size on inputs
             if (!ov::is_type<ov::op::v0::Parameter>(matmul->get_input_node_shared_ptr(0)) ||
@@ -485,6 +495,8 @@ void snippets::op::Subgraph::data_flow_transformations(ov::pass::Manager& pre_co
         common_manager.register_pass<snippets::pass::FuseTransposeBrgemm>();
         common_manager.register_pass<snippets::pass::TransposeDecomposition>();
         common_manager.register_pass<snippets::pass::SetSoftmaxPorts>();
+        // Should be called before ConvertConstantsToScalars to consume the axes Constant
+        common_manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
     }
     common_manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     common_manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
@@ -524,6 +536,7 @@ void snippets::op::Subgraph::control_flow_transformations(lowered::LinearIR& lin
     lowered::pass::PassPipeline common_pipeline;
     common_pipeline.register_pass<lowered::pass::MarkLoops>(vector_size);
     common_pipeline.register_pass<lowered::pass::SoftmaxDecomposition>(vector_size);
+    common_pipeline.register_pass<lowered::pass::ReduceDecomposition>(vector_size);
     common_pipeline.register_pass<lowered::pass::FuseLoops>();
     common_pipeline.register_pass<lowered::pass::MoveResultOutOfLoop>();
     common_pipeline.register_pass<lowered::pass::InsertBuffers>(buffer_allocation_rank);
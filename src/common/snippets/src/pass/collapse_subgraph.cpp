@@ -13,6 +13,7 @@
 #include "snippets/utils.hpp"
 
 #include "openvino/opsets/opset1.hpp"
+#include "openvino/op/util/arithmetic_reductions_keep_dims.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "transformations/utils/utils.hpp"
 #include "ngraph/op/util/attr_types.hpp"
@@ -152,6 +153,24 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
         return axis >= 0 && axis == (rank.get_length() - 1);
     };
 
+    auto is_supported_reduction = [](const std::shared_ptr<const Node> &n) -> bool {
+        // Only the innermost dimension can be reduced in a register, and the reduced dimension
+        // must be kept, since the snippets Reduce ops preserve the input rank
+        if (!ov::is_type<const ov::op::v1::ReduceMax>(n) && !ov::is_type<const ov::op::v1::ReduceSum>(n))
+            return false;
+        const auto reduce = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(n);
+        if (!reduce->get_keep_dims() || n->get_input_partial_shape(0).rank().is_dynamic())
+            return false;
+        const auto rank = n->get_input_partial_shape(0).rank();
+        const auto axes_constant = ov::as_type_ptr<const opset1::Constant>(n->get_input_node_shared_ptr(1));
+        if (!axes_constant || ov::shape_size(axes_constant->get_shape()) != 1)
+            return false;
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        const auto axis = ov::normalize_axis(n->get_friendly_name(), axes_constant->cast_vector<int64_t>()[0], rank);
+        OPENVINO_SUPPRESS_DEPRECATED_END
+        return axis == rank.get_length() - 1;
+    };
+
     auto is_supported_broadcast_op = [](const std::shared_ptr<const Node> &n) -> bool {
         // Broadcast is supported only for MHA tokenization where there are needed and special checks
         if (auto broadcast_v1 = ov::as_type_ptr<const ov::op::v1::Broadcast>(n)) {
@@ -168,6 +187,7 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
            is_supported_ternary_eltwise_op(n) ||
            is_supported_transpose(n) ||
            is_supported_softmax(n) ||
+           is_supported_reduction(n) ||
            is_supported_matmul(n) ||
            is_supported_broadcast_op(n);
 }
@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
+
+#include "snippets/itt.hpp"
+#include "snippets/op/reduce.hpp"
+#include "snippets/lowered/port_descriptor.hpp"
+
+#include "openvino/op/reduce_max.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/op/util/arithmetic_reductions_keep_dims.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "openvino/pass/pattern/op/label.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/validation_util.hpp"
+
+
+ov::snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
+    MATCHER_SCOPE(ReduceToSnippetsReduce);
+
+    auto m_axes = ov::pass::pattern::wrap_type<ov::op::v0::Constant>();
+    auto m_reduce_max = ov::pass::pattern::wrap_type<ov::op::v1::ReduceMax>({ov::pass::pattern::any_input(), m_axes});
+    auto m_reduce_sum = ov::pass::pattern::wrap_type<ov::op::v1::ReduceSum>({ov::pass::pattern::any_input(), m_axes});
+    auto m_reduce = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{m_reduce_max, m_reduce_sum});
+
+    auto callback = [](ov::pass::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceToSnippetsReduce")
+        auto root = m.get_match_root();
+        const auto reduce_base = ov::as_type_ptr<ov::op::util::ArithmeticReductionKeepDims>(root);
+        // The snippets Reduce always keeps the reduced dimension
+        if (!reduce_base || !reduce_base->get_keep_dims())
+            return false;
+        const auto& pshape = root->get_input_partial_shape(0);
+        if (pshape.is_dynamic())
+            return false;
+        const auto rank = pshape.rank();
+
+        const auto axes_constant = ov::as_type_ptr<ov::op::v0::Constant>(root->get_input_node_shared_ptr(1));
+        if (!axes_constant || ov::shape_size(axes_constant->get_shape()) != 1)
+            return false;
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        const auto axis = ov::normalize_axis(root->get_friendly_name(), axes_constant->cast_vector<int64_t>()[0], rank);
+        OPENVINO_SUPPRESS_DEPRECATED_END
+
+        const auto& reduce_input = root->input_value(0);
+        std::shared_ptr<ov::Node> snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMax>(root)) {
+            snippets_reduce = std::make_shared<op::ReduceMax>(reduce_input, static_cast<size_t>(axis));
+        } else if (ov::is_type<ov::op::v1::ReduceSum>(root)) {
+            snippets_reduce = std::make_shared<op::ReduceSum>(reduce_input, static_cast<size_t>(axis));
+        } else {
+            return false;
+        }
+
+        ov::copy_runtime_info(root, snippets_reduce);
+        snippets_reduce->set_friendly_name(root->get_friendly_name());
+        ov::replace_node(root, snippets_reduce);
+
+        std::vector<size_t> subtensor(rank.get_length(), 1);
+        for (auto i = axis; i < rank.get_length(); ++i)
+            subtensor[i] = lowered::PortDescriptor::ServiceDimensions::FULL_DIM;
+        lowered::PortDescriptorUtils::set_port_descriptor_ptr(
+            snippets_reduce->input(0),
+            std::make_shared<lowered::PortDescriptor>(snippets_reduce->input(0), subtensor));
+        lowered::PortDescriptorUtils::set_port_descriptor_ptr(
+            snippets_reduce->output(0),
+            std::make_shared<lowered::PortDescriptor>(snippets_reduce->output(0), subtensor));
+
+        return true;
+    };
+
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(m_reduce, matcher_name), callback);
+}
@@ -0,0 +1,19 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace ov {
+namespace util {
+/// \brief Get the current resident set size (working set) of the process.
+/// \return Returns size in bytes or 0 if the value is not available on the platform.
+size_t get_process_memory_usage();
+
+/// \brief Get the peak resident set size (peak working set) of the process.
+/// \return Returns size in bytes or 0 if the value is not available on the platform.
+size_t get_process_peak_memory_usage();
+}  // namespace util
+}  // namespace ov
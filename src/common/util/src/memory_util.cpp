@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/memory_util.hpp"
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+
+#    include <psapi.h>
+#elif defined(__linux__)
+#    include <cstdio>
+#    include <cstdlib>
+#    include <cstring>
+#endif
+
+namespace {
+
+#if defined(_WIN32)
+
+size_t process_memory_counter(bool peak) {
+    PROCESS_MEMORY_COUNTERS pmc;
+    pmc.cb = sizeof(PROCESS_MEMORY_COUNTERS);
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, pmc.cb))
+        return 0;
+    return peak ? pmc.PeakWorkingSetSize : pmc.WorkingSetSize;
+}
+
+#elif defined(__linux__)
+
+size_t process_memory_counter(bool peak) {
+    const char* key = peak ? "VmHWM:" : "VmRSS:";
+    const size_t key_len = std::strlen(key);
+    size_t result = 0;
+    if (FILE* file = std::fopen("/proc/self/status", "r")) {
+        char line[128];
+        while (std::fgets(line, sizeof(line), file) != nullptr) {
+            if (std::strncmp(line, key, key_len) == 0) {
+                // the value is reported in kB
+                result = std::strtoul(line + key_len, nullptr, 10) * 1024;
+                break;
+            }
+        }
+        std::fclose(file);
+    }
+    return result;
+}
+
+#else
+
+size_t process_memory_counter(bool) {
+    return 0;
+}
+
+#endif
+
+}  // namespace
+
+size_t ov::util::get_process_memory_usage() {
+    return process_memory_counter(false);
+}
+
+size_t ov::util::get_process_peak_memory_usage() {
+    return process_memory_counter(true);
+}
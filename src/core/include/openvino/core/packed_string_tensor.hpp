@@ -0,0 +1,40 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+
+/// \brief Packs a batch of strings into a single contiguous u8 tensor.
+///
+/// OpenVINO has no string element type, so string data is exchanged with custom operations
+/// (e.g. tokenizers) through a packed representation: a 1-D u8 tensor that stores the batch
+/// size as int32, followed by an int32 end offset per string into the byte area, followed by
+/// the concatenated UTF-8 bytes of all strings. The layout keeps the whole batch in one
+/// cache-friendly allocation and avoids per-string heap traffic on the inference path.
+///
+/// Layout: [int32 N][int32 ends[N]][bytes], total size 4 * (N + 1) + sum of string lengths.
+///
+/// \param strings strings to pack
+/// \return 1-D u8 tensor holding the packed representation
+OPENVINO_API
+Tensor pack_strings(const std::vector<std::string>& strings);
+
+/// \brief Unpacks a u8 tensor produced by ov::pack_strings back into a vector of strings.
+///
+/// The tensor is validated against the packed layout; malformed input (wrong element type,
+/// rank, truncated data or non-monotonic offsets) raises ov::Exception.
+///
+/// \param packed 1-D u8 tensor holding the packed representation
+/// \return the unpacked strings
+OPENVINO_API
+std::vector<std::string> unpack_strings(const Tensor& packed);
+
+}  // namespace ov
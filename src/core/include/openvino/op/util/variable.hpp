@@ -14,6 +14,10 @@
 namespace ov {
 namespace op {
 namespace util {
+/// \brief Describes a state of a stateful model: its identifier, element type and shape.
+/// The shape is the contract the plugins size the state memory by - they allocate the
+/// backing buffers while the model is compiled (or the infer request is created), not on
+/// the first inference, so devices without dynamic state support require it to be static.
 struct VariableInfo {
     PartialShape data_shape;
     element::Type data_type;
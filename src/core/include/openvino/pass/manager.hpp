@@ -14,6 +14,22 @@
 
 namespace ov {
 namespace pass {
+/**
+ * @brief Per-pass execution statistics collected by Manager::run_passes when profiling is enabled
+ * @ingroup ov_pass_cpp_api
+ */
+struct PassProfilingInfo {
+    std::string name;
+    /// Wall time spent in the pass
+    uint64_t microseconds = 0;
+    /// Operation count of the model before and after the pass; equal values together with
+    /// applied == false identify passes that walk the graph without changing it
+    size_t ops_before = 0;
+    size_t ops_after = 0;
+    /// Whether the pass reported that it changed the model
+    bool applied = false;
+};
+
 /**
  * @brief Manager class allows to manage transformation passes
  * @ingroup ov_pass_cpp_api
@@ -71,6 +87,19 @@ public:
     void set_pass_visualization(bool new_state) {
         m_visualize = new_state;
     }
+    /// \brief Enable or disable collection of per-pass statistics during run_passes.
+    /// Profiling can also be enabled for all managers with the OV_PROFILE_PASS_ENABLE
+    /// environment variable, and the collected timeline is additionally dumped in the
+    /// chrome-trace format to the file set by OV_PROFILE_PASS_TRACE.
+    /// \param new_state Value "true" enables statistics collection; "false", otherwise
+    void set_profiling(bool new_state) {
+        m_profiling = new_state;
+    }
+    /// \return Statistics of the passes executed by the last run_passes call.
+    /// Empty unless profiling was enabled.
+    const std::vector<PassProfilingInfo>& get_profiling_info() const {
+        return m_profiling_info;
+    }
     /// \brief Set flag to enable/disable running Validate pass after executing
     /// each registered pass
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
@@ -97,8 +126,10 @@ protected:
 
     std::shared_ptr<PassConfig> m_pass_config;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
+    std::vector<PassProfilingInfo> m_profiling_info;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    bool m_profiling = false;
 };
 }  // namespace pass
 }  // namespace ov
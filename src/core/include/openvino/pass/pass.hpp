@@ -22,6 +22,10 @@ enum class PassProperty : uint32_t {
     REQUIRE_STATIC_SHAPE = 0x1,
     // Pass transformation will change the function's dynamic state
     CHANGE_DYNAMIC_STATE = 1 << 1,
+    // Matcher pass declares that its result does not depend on the node visiting order or on
+    // observing the fully transformed graph between neighbouring passes, so the manager may fold
+    // it with adjacent passes of the same kind into a single GraphRewrite sweep
+    ORDER_INSENSITIVE = 1 << 2,
 };
 
 using PassPropertyMask = ov::EnumMask<PassProperty>;
@@ -149,6 +149,11 @@ public:
      * @param begin start coordinate of ROI object inside of the original object.
      * @param end end coordinate of ROI object inside of the original object.
      * @note A Number of dimensions in `begin` and `end` must match number of dimensions in `other.get_shape()`
+     * @note The ROI tensor shares the memory of `other`: it keeps the original strides and points into the
+     * original buffer at the `begin` offset, so no data is copied. A slice taken along the outermost dimension
+     * only keeps default (dense) strides for its shape and reports is_continuous() == true, which allows plugins
+     * to consume such views without an extra copy (e.g. when one pinned input buffer is split across several
+     * infer requests). Slices along inner dimensions produce non-dense views and may be copied by a plugin.
      */
     Tensor(const Tensor& other, const Coordinate& begin, const Coordinate& end);
 
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -112,6 +113,21 @@ template <>
 void convert<float, int8_t>(const float* arg, int8_t* out, size_t count);
 template <>
 void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count);
+template <>
+void convert<bfloat16, float>(const bfloat16* arg, float* out, size_t count);
+template <>
+void convert<float, bfloat16>(const float* arg, bfloat16* out, size_t count);
+
+#elif defined(OPENVINO_ARCH_ARM64)
+
+template <>
+void convert<float16, float>(const float16* arg, float* out, size_t count);
+template <>
+void convert<float, float16>(const float* arg, float16* out, size_t count);
+template <>
+void convert<bfloat16, float>(const bfloat16* arg, float* out, size_t count);
+template <>
+void convert<float, bfloat16>(const float* arg, bfloat16* out, size_t count);
 
 #endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
 
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <numeric>
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
@@ -206,18 +207,69 @@ bool no_axis_reordering(const AxisVector& axis_order) {
     tmp.erase(std::unique(begin(tmp), end(tmp)), end(tmp));
     return tmp == axis_order;
 }
-}  // namespace
-void runtime::opt_kernel::reshape(const char* in,
-                                  char* out,
-                                  const Shape& in_shape,
-                                  const AxisVector& in_axis_order,
-                                  const Shape& out_shape,
-                                  size_t elem_size) {
-    if (no_axis_reordering(in_axis_order)) {
-        std::memcpy(out, in, shape_size(in_shape) * elem_size);
-        return;
+
+// Reduces the transposition to an equivalent one of smaller rank: size-1 axes are
+// dropped and input axes that stay adjacent and in order after the permutation are
+// merged. A merged trailing axis is folded into the element size, so the per-rank
+// kernels copy whole contiguous blocks instead of single elements.
+void simplify_transpose(Shape& in_shape, AxisVector& in_axis_order, size_t& elem_size) {
+    const size_t rank = in_shape.size();
+
+    // Drop size-1 axes, they do not affect the element order
+    Shape sq_shape;
+    AxisVector sq_order;
+    std::vector<size_t> sq_axis_id(rank, SIZE_MAX);
+    for (size_t axis = 0; axis < rank; ++axis) {
+        if (in_shape[axis] != 1) {
+            sq_axis_id[axis] = sq_shape.size();
+            sq_shape.push_back(in_shape[axis]);
+        }
+    }
+    for (const auto axis : in_axis_order) {
+        if (sq_axis_id[axis] != SIZE_MAX)
+            sq_order.push_back(sq_axis_id[axis]);
+    }
+
+    // Merge runs of input axes that remain consecutive in the output
+    std::vector<std::pair<size_t, size_t>> runs;  // (first input axis, merged size)
+    for (size_t i = 0; i < sq_order.size(); ++i) {
+        const size_t axis = sq_order[i];
+        if (i > 0 && axis == sq_order[i - 1] + 1)
+            runs.back().second *= sq_shape[axis];
+        else
+            runs.emplace_back(axis, sq_shape[axis]);
+    }
+
+    std::vector<size_t> by_start(runs.size());
+    std::iota(begin(by_start), end(by_start), 0);
+    std::sort(begin(by_start), end(by_start), [&runs](size_t a, size_t b) {
+        return runs[a].first < runs[b].first;
+    });
+
+    in_shape = Shape(runs.size());
+    in_axis_order = AxisVector(runs.size());
+    std::vector<size_t> merged_id(runs.size());
+    for (size_t pos = 0; pos < runs.size(); ++pos) {
+        in_shape[pos] = runs[by_start[pos]].second;
+        merged_id[by_start[pos]] = pos;
     }
+    for (size_t i = 0; i < runs.size(); ++i)
+        in_axis_order[i] = merged_id[i];
 
+    // The innermost axis is contiguous in both layouts - copy it as one block
+    if (!in_axis_order.empty() && in_axis_order.back() + 1 == in_shape.size()) {
+        elem_size *= in_shape.back();
+        in_shape.pop_back();
+        in_axis_order.pop_back();
+    }
+}
+
+void reshape_dispatch(const char* in,
+                      char* out,
+                      const Shape& in_shape,
+                      const AxisVector& in_axis_order,
+                      const Shape& out_shape,
+                      size_t elem_size) {
     switch (in_shape.size()) {
     case 0:
         reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size);
@@ -241,7 +293,30 @@ void runtime::opt_kernel::reshape(const char* in,
         reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     default:
-        reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        runtime::reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
         break;
     }
 }
+}  // namespace
+void runtime::opt_kernel::reshape(const char* in,
+                                  char* out,
+                                  const Shape& in_shape,
+                                  const AxisVector& in_axis_order,
+                                  const Shape& out_shape,
+                                  size_t elem_size) {
+    if (no_axis_reordering(in_axis_order)) {
+        std::memcpy(out, in, shape_size(in_shape) * elem_size);
+        return;
+    }
+
+    Shape opt_in_shape = in_shape;
+    AxisVector opt_axis_order = in_axis_order;
+    size_t opt_elem_size = elem_size;
+    simplify_transpose(opt_in_shape, opt_axis_order, opt_elem_size);
+
+    Shape opt_out_shape(opt_in_shape.size());
+    for (size_t i = 0; i < opt_in_shape.size(); ++i)
+        opt_out_shape[i] = opt_in_shape[opt_axis_order[i]];
+
+    reshape_dispatch(in, out, opt_in_shape, opt_axis_order, opt_out_shape, opt_elem_size);
+}
@@ -53,6 +53,45 @@ void jit_convert_vec<float, float16>(jit::Generator& gen, const Xbyak::RegExp& s
     gen.vmovdqu(gen.xword[dst], f16vec);
 }
 
+template <>
+void jit_convert_vec<bfloat16, float>(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto f32vec = gen.ymm4;
+
+    gen.vpmovzxwd(f32vec, gen.xword[src]);  // zero-extend 8 bf16's to 8 dwords
+    gen.vpslld(f32vec, f32vec, 16);         // shift them into the upper halves == fp32 bits
+    gen.vmovups(gen.yword[dst], f32vec);
+}
+
+template <>
+void jit_convert_vec_prepare<float, bfloat16>(jit::Generator& gen) {
+    auto mask = gen.ymm1;
+    auto addr = gen.r15;
+
+    static const uint32_t mask_data[8] = {0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000};
+
+    gen.mov(addr, (size_t)mask_data);    // get mask_data[] address
+    gen.vmovdqu(mask, gen.yword[addr]);  // save mask_data[] to ymm register
+}
+
+template <>
+void jit_convert_vec<float, bfloat16>(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto mask = gen.ymm1;
+    auto f32vec = gen.ymm2;
+    auto f32vec_lo = gen.xmm2;
+    auto bias = gen.ymm3;
+    auto f32vec_hi = gen.xmm3;
+    auto bf16vec = gen.xmm4;
+
+    gen.vmovdqu(f32vec, gen.yword[src]);
+    gen.vpsrld(bias, f32vec, 1);
+    gen.vpand(bias, bias, mask);                   // bias = (v >> 16) & 1 ? 0x8000 : 0
+    gen.vpaddd(f32vec, f32vec, bias);              // round to nearest even as the scalar ctor does
+    gen.vpsrld(f32vec, f32vec, 16);                // keep the upper halves
+    gen.vextracti128(f32vec_hi, f32vec, 1);        // extract upper part of f32vec
+    gen.vpackusdw(bf16vec, f32vec_lo, f32vec_hi);  // pack 8 dwords to 8 words
+    gen.vmovdqu(gen.xword[dst], bf16vec);
+}
+
 template <>
 void jit_convert_vec_prepare<float, int8_t>(jit::Generator& gen) {
     auto order = gen.ymm1;
@@ -231,6 +270,82 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count) {
     convert_impl(arg, out, count);
 }
 
+template <>
+void convert<bfloat16, float>(const bfloat16* arg, float* out, size_t count) {
+    convert_impl(arg, out, count);
+}
+
+template <>
+void convert<float, bfloat16>(const float* arg, bfloat16* out, size_t count) {
+    convert_impl(arg, out, count);
+}
+
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
+
+#elif defined(OPENVINO_ARCH_ARM64)
+
+#    include <arm_neon.h>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+
+// The half-precision conversion instructions are part of baseline armv8-a, so unlike the
+// x86 path above no runtime dispatch is needed. fcvtn rounds to nearest even just as the
+// scalar float16 constructor does.
+
+template <>
+void convert<float16, float>(const float16* arg, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(out + i, vcvt_f32_f16(vld1_f16(reinterpret_cast<const float16_t*>(arg + i))));
+    }
+    for (; i < count; ++i) {
+        out[i] = static_cast<float>(arg[i]);
+    }
+}
+
+template <>
+void convert<float, float16>(const float* arg, float16* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        vst1_f16(reinterpret_cast<float16_t*>(out + i), vcvt_f16_f32(vld1q_f32(arg + i)));
+    }
+    for (; i < count; ++i) {
+        out[i] = static_cast<float16>(arg[i]);
+    }
+}
+
+template <>
+void convert<bfloat16, float>(const bfloat16* arg, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto vec = vld1_u16(reinterpret_cast<const uint16_t*>(arg + i));
+        // shift 8 bf16's into the upper halves == fp32 bits
+        vst1q_f32(out + i, vreinterpretq_f32_u32(vshll_n_u16(vec, 16)));
+    }
+    for (; i < count; ++i) {
+        out[i] = static_cast<float>(arg[i]);
+    }
+}
+
+template <>
+void convert<float, bfloat16>(const float* arg, bfloat16* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        auto vec = vreinterpretq_u32_f32(vld1q_f32(arg + i));
+        // bias = (v >> 16) & 1 ? 0x8000 : 0 — round to nearest even as the scalar ctor does
+        const auto bias = vandq_u32(vshrq_n_u32(vec, 1), vdupq_n_u32(0x8000u));
+        vec = vshrq_n_u32(vaddq_u32(vec, bias), 16);
+        vst1_u16(reinterpret_cast<uint16_t*>(out + i), vmovn_u32(vec));
+    }
+    for (; i < count; ++i) {
+        out[i] = static_cast<bfloat16>(arg[i]);
+    }
+}
+
 }  // namespace reference
 }  // namespace runtime
 }  // namespace ngraph
@@ -298,21 +298,25 @@ std::pair<ov::Tensor, ov::Tensor> ov::evaluate_both_bounds(const Output<Node>& o
     std::vector<Node*> order;
     if (could_propagate(output, order)) {
         for (const auto& node : order) {
+            const auto& input_values = node->input_values();
+            // When every input bound is a point value the output bounds coincide as well, so
+            // the upper evaluation would just repeat the lower one on the very same tensors.
+            // Fully determined shape subgraphs are then walked once instead of twice.
+            bool same_inputs = std::all_of(input_values.begin(), input_values.end(), [](const Output<Node>& input) {
+                auto& t = input.get_tensor();
+                return t.has_and_set_bound() || are_equal(t.get_lower_value(), t.get_upper_value());
+            });
             ov::TensorVector outputs_lower, outputs_upper;
             for (const auto& out : node->outputs()) {
                 OPENVINO_SUPPRESS_DEPRECATED_START
                 outputs_lower.push_back(util::wrap_tensor(out));
-                outputs_upper.push_back(util::wrap_tensor(out));
+                if (!same_inputs)
+                    outputs_upper.push_back(util::wrap_tensor(out));
                 OPENVINO_SUPPRESS_DEPRECATED_END
             }
-            if (!node->evaluate_lower(outputs_lower) || !node->evaluate_upper(outputs_upper)) {
+            if (!node->evaluate_lower(outputs_lower) || (!same_inputs && !node->evaluate_upper(outputs_upper))) {
                 break;
             }
-            auto input_values = node->input_values();
-            bool same_inputs = std::all_of(input_values.begin(), input_values.end(), [](const Output<Node>& input) {
-                auto& t = input.get_tensor();
-                return t.has_and_set_bound() || are_equal(t.get_lower_value(), t.get_upper_value());
-            });
             TensorLabelVector output_labels(node->get_output_size());
             bool labels_evaluated = node->evaluate_label(output_labels);
             for (size_t i = 0; i < node->get_output_size(); ++i) {
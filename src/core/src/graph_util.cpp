@@ -219,15 +219,18 @@ namespace {
 void clone_ov_nodes(const std::vector<std::shared_ptr<ov::Node>>& nodes,
                     std::unordered_map<ov::Node*, std::shared_ptr<ov::Node>>& node_map) {
     // for each node in topological order
+    node_map.reserve(node_map.size() + nodes.size());
     for (const auto& node : nodes) {
         if (!node_map.count(node.get())) {
             // get (already) cloned arguments and clone the node
             ov::OutputVector cloned_args;
+            cloned_args.reserve(node->get_input_size());
             for (const auto& input : node->inputs()) {
                 ov::Output<ov::Node> output = input.get_source_output();
                 cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
             }
             std::vector<std::shared_ptr<ov::Node>> cloned_dependencies;
+            cloned_dependencies.reserve(node->get_control_dependencies().size());
             for (const auto& dependency : node->get_control_dependencies()) {
                 shared_ptr<ov::Node>& dependent = node_map.at(dependency.get());
                 if (find(cloned_dependencies.begin(), cloned_dependencies.end(), dependent) ==
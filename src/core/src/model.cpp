@@ -232,27 +232,28 @@ void ov::Model::validate_nodes_and_infer_types() const {
         int cnt_assign = 0;
         int cnt_read_val = 0;
     };
-    std::map<ov::op::util::Variable*, Counter> pair_checker;
+    std::unordered_map<ov::op::util::Variable*, Counter> pair_checker;
     std::stringstream unregistered_parameters;
     std::stringstream unregistered_variables;
-    std::unordered_set<const ov::descriptor::Tensor*> tensors;
+
+    // Membership checks below run for every matching node, so linear search over
+    // m_parameters/m_variables makes validation quadratic on large models
+    std::unordered_set<const ov::Node*> registered_parameters;
+    registered_parameters.reserve(m_parameters.size());
+    for (const auto& parameter : m_parameters)
+        registered_parameters.insert(parameter.get());
+    std::unordered_set<const ov::op::util::Variable*> registered_variables;
+    registered_variables.reserve(m_variables.size());
+    for (const auto& variable : m_variables)
+        registered_variables.insert(variable.get());
 
     for (auto& node : get_ordered_ops()) {
         node->revalidate_and_infer_types();
-        for (const auto& output : node->outputs()) {
-            const auto& tensor = output.get_tensor();
-            // Skip results outputs tensors because result_input_tensor == result_output_tensor
-            if (tensors.count(&tensor))
-                continue;
-            tensors.insert(&tensor);
-        }
-        if (op::util::is_parameter(node) &&
-            std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
+        if (op::util::is_parameter(node) && !registered_parameters.count(node.get()))
             unregistered_parameters << node << std::endl;
 
         const auto& variable_op = dynamic_pointer_cast<op::util::VariableExtension>(node);
-        if (variable_op &&
-            std::find(m_variables.begin(), m_variables.end(), variable_op->get_variable()) == m_variables.end())
+        if (variable_op && !registered_variables.count(variable_op->get_variable().get()))
             unregistered_variables << variable_op->get_variable_id() << std::endl;
 
         if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(node)) {
@@ -293,6 +294,7 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
 
     NodeVector nodes;
     if (m_shared_rt_info->get_use_topological_cache()) {
+        nodes.reserve(m_cached_ordered_ops.size());
         for (const auto& node : m_cached_ordered_ops) {
             if (auto locked_node = node.lock()) {
                 nodes.emplace_back(locked_node);
@@ -867,12 +869,47 @@ void ov::Model::reshape(const std::map<ov::Output<ov::Node>, ov::PartialShape>&
         validate_nodes_and_infer_types();
     };
 
+    // Shape-only update of an otherwise untouched model: revalidate just the
+    // subgraph reachable from the changed parameters and stop propagating where
+    // inferred outputs are unchanged. Repeated reshapes between known shapes
+    // then skip the bulk of the graph instead of re-running full validation.
+    auto reshape_incremental = [&](const std::unordered_map<ov::op::v0::Parameter*, ov::PartialShape>& pshapes) {
+        std::unordered_set<const ov::Node*> dirty;
+        for (const auto& pshape : pshapes) {
+            pshape.first->set_partial_shape(pshape.second);
+            dirty.insert(pshape.first);
+        }
+
+        for (const auto& node : get_ordered_ops()) {
+            if (!dirty.count(node.get()))
+                continue;
+
+            std::vector<std::pair<ov::element::Type, ov::PartialShape>> prev_outputs;
+            prev_outputs.reserve(node->get_output_size());
+            for (const auto& output : node->outputs())
+                prev_outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+
+            node->validate_and_infer_types();
+
+            for (size_t i = 0; i < node->get_output_size(); ++i) {
+                if (i >= prev_outputs.size() || prev_outputs[i].first != node->get_output_element_type(i) ||
+                    prev_outputs[i].second != node->get_output_partial_shape(i)) {
+                    for (const auto& input : node->output(i).get_target_inputs())
+                        dirty.insert(input.get_node());
+                }
+            }
+        }
+    };
+
     try {
         ov::pass::Manager ssr_manager;
         ssr_manager.register_pass<ov::pass::SmartReshape>();
-        ssr_manager.run_passes(shared_from_this());
+        const bool model_changed = ssr_manager.run_passes(shared_from_this());
 
-        reshape_only(new_param_shapes);
+        if (model_changed)
+            reshape_only(new_param_shapes);
+        else
+            reshape_incremental(new_param_shapes);
     } catch (...) {
         // restore shapes to original ones
         reshape_only(original_input_shapes);
@@ -180,6 +180,7 @@ void ov::Node::set_arguments(const NodeVector& arguments) {
 void ov::Node::set_arguments(const OutputVector& arguments) {
     // Remove existing inputs of this node
     m_inputs.clear();
+    m_inputs.reserve(arguments.size());
 
     // Add this node as a user of each argument.
     size_t i = 0;
@@ -230,6 +231,7 @@ void ov::Node::constructor_validate_and_infer_types() {
 
 void ov::Node::set_output_size(size_t n) {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
+    m_outputs.reserve(n);
     for (size_t i = m_outputs.size(); i < n; ++i) {
         // create the descriptors
         get_output_descriptor(i);
@@ -609,6 +611,7 @@ ov::Output<const ov::Node> ov::Node::output(size_t output_index) const {
 
 vector<ov::Input<ov::Node>> ov::Node::inputs() {
     vector<Input<Node>> result;
+    result.reserve(get_input_size());
 
     for (size_t i = 0; i < get_input_size(); i++) {
         result.emplace_back(this, i);
@@ -619,6 +622,7 @@ vector<ov::Input<ov::Node>> ov::Node::inputs() {
 
 vector<ov::Output<ov::Node>> ov::Node::input_values() const {
     vector<Output<Node>> result;
+    result.reserve(get_input_size());
 
     for (size_t i = 0; i < get_input_size(); i++) {
         result.emplace_back(input(i).get_source_output());
@@ -629,6 +633,7 @@ vector<ov::Output<ov::Node>> ov::Node::input_values() const {
 
 vector<ov::Input<const ov::Node>> ov::Node::inputs() const {
     vector<Input<const Node>> result;
+    result.reserve(get_input_size());
 
     for (size_t i = 0; i < get_input_size(); i++) {
         result.emplace_back(this, i);
@@ -639,6 +644,7 @@ vector<ov::Input<const ov::Node>> ov::Node::inputs() const {
 
 vector<ov::Output<ov::Node>> ov::Node::outputs() {
     vector<Output<Node>> result;
+    result.reserve(get_output_size());
 
     for (size_t i = 0; i < get_output_size(); i++) {
         result.emplace_back(shared_from_this(), i);
@@ -649,6 +655,7 @@ vector<ov::Output<ov::Node>> ov::Node::outputs() {
 
 vector<ov::Output<const ov::Node>> ov::Node::outputs() const {
     vector<Output<const Node>> result;
+    result.reserve(get_output_size());
 
     for (size_t i = 0; i < get_output_size(); i++) {
         result.emplace_back(shared_from_this(), i);
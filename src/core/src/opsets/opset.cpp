@@ -88,6 +88,7 @@ const ov::OpSet& ov::get_opset1() {
     static OpSet opset("opset1");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset1");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset1, NAME, NAMESPACE);
 #include "openvino/opsets/opset1_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -99,6 +100,7 @@ const ov::OpSet& ov::get_opset2() {
     static OpSet opset("opset2");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset2");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset2, NAME, NAMESPACE);
 #include "openvino/opsets/opset2_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -110,6 +112,7 @@ const ov::OpSet& ov::get_opset3() {
     static OpSet opset("opset3");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset3");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset3, NAME, NAMESPACE);
 #include "openvino/opsets/opset3_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -121,6 +124,7 @@ const ov::OpSet& ov::get_opset4() {
     static OpSet opset("opset4");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset4");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset4, NAME, NAMESPACE);
 #include "openvino/opsets/opset4_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -132,6 +136,7 @@ const ov::OpSet& ov::get_opset5() {
     static OpSet opset("opset5");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset5");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset5, NAME, NAMESPACE);
 #include "openvino/opsets/opset5_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -143,6 +148,7 @@ const ov::OpSet& ov::get_opset6() {
     static OpSet opset("opset6");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset6");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset6, NAME, NAMESPACE);
 #include "openvino/opsets/opset6_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -154,6 +160,7 @@ const ov::OpSet& ov::get_opset7() {
     static OpSet opset("opset7");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset7");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset7, NAME, NAMESPACE);
 #include "openvino/opsets/opset7_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -165,6 +172,7 @@ const ov::OpSet& ov::get_opset8() {
     static OpSet opset("opset8");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset8");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset8, NAME, NAMESPACE);
 #include "openvino/opsets/opset8_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -176,6 +184,7 @@ const ov::OpSet& ov::get_opset9() {
     static OpSet opset("opset9");
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset9");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) INSERT_OP(opset9, NAME, NAMESPACE);
 #include "openvino/opsets/opset9_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -187,6 +196,7 @@ const ov::OpSet& ov::get_opset10() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset10");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
 #include "openvino/opsets/opset10_tbl.hpp"
 #undef _OPENVINO_OP_REG
@@ -198,6 +208,7 @@ const ov::OpSet& ov::get_opset11() {
     static OpSet opset;
     static std::once_flag flag;
     std::call_once(flag, [&]() {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::core, "ov::get_opset11");
 #define _OPENVINO_OP_REG(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
 #include "openvino/opsets/opset11_tbl.hpp"
 #undef _OPENVINO_OP_REG
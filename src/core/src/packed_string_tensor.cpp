@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/packed_string_tensor.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+
+Tensor pack_strings(const std::vector<std::string>& strings) {
+    const auto batch = strings.size();
+    size_t total_bytes = 0;
+    for (const auto& s : strings)
+        total_bytes += s.size();
+
+    Tensor packed(element::u8, Shape{4 * (batch + 1) + total_bytes});
+    auto* data = packed.data<uint8_t>();
+    auto* pbatch = reinterpret_cast<int32_t*>(data);
+    pbatch[0] = static_cast<int32_t>(batch);
+    auto* pends = pbatch + 1;
+    auto* pchars = data + 4 * (batch + 1);
+    int32_t offset = 0;
+    for (size_t i = 0; i < batch; ++i) {
+        offset += static_cast<int32_t>(strings[i].size());
+        pends[i] = offset;
+        std::memcpy(pchars + offset - strings[i].size(), strings[i].data(), strings[i].size());
+    }
+    return packed;
+}
+
+std::vector<std::string> unpack_strings(const Tensor& packed) {
+    OPENVINO_ASSERT(packed.get_element_type() == element::u8, "Packed string tensor must have u8 element type");
+    OPENVINO_ASSERT(packed.get_shape().size() == 1, "Packed string tensor must be 1-D");
+    const auto size = packed.get_shape()[0];
+    OPENVINO_ASSERT(size >= 4, "Packed string tensor is too small to hold the batch size");
+
+    const auto* data = packed.data<uint8_t>();
+    const auto signed_batch = reinterpret_cast<const int32_t*>(data)[0];
+    OPENVINO_ASSERT(signed_batch >= 0, "Packed string tensor has a negative batch size");
+    const auto batch = static_cast<size_t>(signed_batch);
+    OPENVINO_ASSERT(size >= 4 * (batch + 1), "Packed string tensor is too small to hold the offsets");
+    const auto* pends = reinterpret_cast<const int32_t*>(data) + 1;
+    const auto* pchars = data + 4 * (batch + 1);
+    const auto chars_size = size - 4 * (batch + 1);
+
+    std::vector<std::string> strings;
+    strings.reserve(batch);
+    int32_t begin = 0;
+    for (size_t i = 0; i < batch; ++i) {
+        const auto end = pends[i];
+        OPENVINO_ASSERT(begin <= end && static_cast<size_t>(end) <= chars_size,
+                        "Packed string tensor has invalid end offset at position ",
+                        i);
+        strings.emplace_back(reinterpret_cast<const char*>(pchars + begin), end - begin);
+        begin = end;
+    }
+    return strings;
+}
+
+}  // namespace ov
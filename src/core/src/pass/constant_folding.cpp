@@ -5,6 +5,7 @@
 #include "openvino/pass/constant_folding.hpp"
 
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_set>
 
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
@@ -56,9 +57,42 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
-        if (rewritten) {
+    // The model is expected to be valid on entry, so instead of revalidating every
+    // remaining node once anything was rewritten, track the nodes whose inputs were
+    // actually replaced and revalidate only those (plus their consumers whenever
+    // revalidation changed an output type or shape).
+    std::unordered_set<const Node*> requires_revalidation;
+    const auto mark_consumers = [&requires_revalidation](const Output<Node>& output) {
+        for (const auto& input : output.get_target_inputs())
+            requires_revalidation.insert(input.get_node());
+    };
+
+    const auto ordered_ops = model->get_ordered_ops();
+
+    if (rewritten) {
+        // Every replacement made by pre_calculated_values_folding() substitutes an
+        // output with a new Constant, so consumers of constants form a superset of
+        // the nodes whose inputs changed there
+        for (const auto& node : ordered_ops) {
+            if (ov::is_type<ov::op::v0::Constant>(node))
+                mark_consumers(node->output(0));
+        }
+    }
+
+    for (const auto& node : ordered_ops) {
+        if (requires_revalidation.count(node.get())) {
+            std::vector<std::pair<element::Type, PartialShape>> prev_outputs;
+            prev_outputs.reserve(node->get_output_size());
+            for (const auto& output : node->outputs())
+                prev_outputs.emplace_back(output.get_element_type(), output.get_partial_shape());
+
             node->validate_and_infer_types();
+
+            for (size_t i = 0; i < node->get_output_size(); ++i) {
+                if (i >= prev_outputs.size() || prev_outputs[i].first != node->get_output_element_type(i) ||
+                    prev_outputs[i].second != node->get_output_partial_shape(i))
+                    mark_consumers(node->output(i));
+            }
         }
 
         OutputVector replacements(node->get_output_size());
@@ -83,6 +117,8 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                     copy_runtime_info_from_input_values(node);
                     // Propagate runtime info attributes to replacement
                     copy_runtime_info(node, replacement.get_node_shared_ptr());
+                    // Consumers were moved to the replacement output and have to be revalidated
+                    mark_consumers(replacement);
 
                     rewritten = true;
                 }
@@ -16,7 +16,9 @@
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/util/op_types.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/pass/pattern/op/any_output.hpp"
 #include "perf_counters.hpp"
 
 /* GraphRewrite algorithm:
@@ -66,6 +68,76 @@ PerfCounters& perf_counters_graph_rewrite() {
 
 #endif  // ENABLE_PROFILING_ITT
 
+namespace {
+
+// Cheap structural guard compiled from a pattern root: the required input count and the
+// admissible node types per input position. The guard is a necessary condition for the
+// full recursive match, so evaluating it first discriminates most candidate nodes with a
+// few type checks instead of a backtracking traversal of the whole pattern.
+struct MatchGuard {
+    bool arity_checked = false;
+    size_t arity = 0;
+    std::vector<std::vector<ov::NodeTypeInfo>> input_types;  // empty list - any type
+
+    bool admits(const std::shared_ptr<ov::Node>& node) const {
+        if (!arity_checked)
+            return true;
+        if (node->get_input_size() != arity)
+            return false;
+        // Commutative nodes may match the pattern arguments in any permutation,
+        // so only the arity part of the guard applies to them
+        if (input_types.empty() || ngraph::op::is_commutative(node.get()))
+            return true;
+        for (size_t i = 0; i < arity; ++i) {
+            const auto& admissible = input_types[i];
+            if (admissible.empty())
+                continue;
+            const auto& input_type = node->input_value(i).get_node()->get_type_info();
+            if (std::none_of(admissible.begin(), admissible.end(), [&](const ov::NodeTypeInfo& type) {
+                    return input_type.is_castable(type);
+                }))
+                return false;
+        }
+        return true;
+    }
+};
+
+MatchGuard compile_match_guard(const std::shared_ptr<ov::pass::MatcherPass>& pass) {
+    MatchGuard guard;
+    auto matcher = pass->get_matcher();
+    if (!matcher)
+        return guard;
+    auto root = matcher->get_pattern_value().get_node_shared_ptr();
+    if (auto any_output = std::dynamic_pointer_cast<ov::pass::pattern::op::AnyOutput>(root))
+        root = any_output->input_value(0).get_node_shared_ptr();
+    // Only roots matched through match_arguments have a fixed arity: a WrapType with
+    // declared inputs or a concrete operation. Other pattern ops come with their own
+    // argument semantics and stay unguarded.
+    const bool is_pattern_op = std::dynamic_pointer_cast<ov::pass::pattern::op::Pattern>(root) != nullptr;
+    const bool is_wrap_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(root) != nullptr;
+    if ((is_pattern_op && !is_wrap_type) || root->get_input_size() == 0)
+        return guard;
+    guard.arity_checked = true;
+    guard.arity = root->get_input_size();
+    bool any_input_typed = false;
+    for (const auto& input : root->input_values()) {
+        const auto& input_node = input.get_node_shared_ptr();
+        std::vector<ov::NodeTypeInfo> admissible;
+        if (auto wrap_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(input_node)) {
+            admissible = wrap_type->get_wrapped_types();
+        } else if (!std::dynamic_pointer_cast<ov::pass::pattern::op::Pattern>(input_node)) {
+            admissible.push_back(input_node->get_type_info());
+        }
+        any_input_typed |= !admissible.empty();
+        guard.input_types.push_back(std::move(admissible));
+    }
+    if (!any_input_typed)
+        guard.input_types.clear();
+    return guard;
+}
+
+}  // namespace
+
 bool ov::pass::BackwardGraphRewrite::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(BackwardGraphRewrite);
     // Initialize execution queue with nodes in topological order
@@ -93,18 +165,22 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Matchers with a type based root node are indexed by that type for fast dispatch;
+    // the rest have an unknown root and have to be tried on every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> untyped_matchers;
+    std::vector<MatchGuard> match_guards(m_matchers.size());
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
             continue;
 
+        match_guards[matcher_index] = compile_match_guard(m_matchers[matcher_index]);
+
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            untyped_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -117,15 +193,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
         // it's type
         // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // and the matcher is tried on every node.
         if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
             if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
                 for (const auto& root_type_info : any_type->get_wrapped_types()) {
                     type_to_matcher[root_type_info].push_back(matcher_index);
                 }
             } else {
-                all_roots_has_type = false;
-                break;
+                untyped_matchers.push_back(matcher_index);
             }
         } else {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
@@ -167,8 +242,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
+    // Collected matcher lists per node type; nodes of the same type consult the
+    // same matchers, so the hierarchy walk and sort are done once per type
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> matchers_by_node_type;
 
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
@@ -192,11 +268,14 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
+        // Collect matchers whose root can possibly match this node type: the ones
+        // indexed by the type (or any of its parents) plus the untyped fallbacks.
+        // The list is memoized per node type as it only depends on the type.
+        const auto& node_type = node->get_type_info();
+        auto cached = matchers_by_node_type.find(node_type);
+        if (cached == matchers_by_node_type.end()) {
+            std::vector<size_t> matcher_passes_to_run = untyped_matchers;
+            const DiscreteTypeInfo* node_type_info = &node_type;
             while (node_type_info) {
                 auto matchers = type_to_matcher.find(*node_type_info);
                 if (matchers != type_to_matcher.end()) {
@@ -212,27 +291,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
             std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
+            cached = matchers_by_node_type.emplace(node_type, std::move(matcher_passes_to_run)).first;
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+
+        for (size_t matcher_index : cached->second) {
+            // The guard rejects most non-candidates with a couple of type checks,
+            // leaving the recursive matcher to run only on structurally viable nodes
+            if (!match_guards[matcher_index].admits(node))
+                continue;
+            if (run_matcher_pass(m_matchers[matcher_index], node)) {
+                rewritten = true;
+                break;
             }
         }
     }
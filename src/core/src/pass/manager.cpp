@@ -5,11 +5,15 @@
 #include "ngraph/pass/manager.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "ngraph/function.hpp"
@@ -20,6 +24,9 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/pass/pattern/op/any_output.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
 
@@ -45,6 +52,75 @@ bool getenv_visualize_tracing() {
     return ov::util::getenv_bool("NGRAPH_ENABLE_VISUALIZE_TRACING") ||
            ov::util::getenv_bool("OV_ENABLE_VISUALIZE_TRACING");
 }
+
+// Collects the type infos (including the base types) of all operations in the model,
+// recursing into subgraph bodies since GraphRewrite applies matchers there as well
+void collect_op_types(const std::shared_ptr<ov::Model>& model, std::unordered_set<ov::NodeTypeInfo>& types) {
+    for (const auto& node : model->get_ops()) {
+        const ov::DiscreteTypeInfo* type = &node->get_type_info();
+        while (type) {
+            types.insert(*type);
+            type = type->parent;
+        }
+        if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+            if (sub_graph_node->get_transformations_allowed()) {
+                for (size_t i = 0; i < sub_graph_node->get_internal_subgraphs_size(); ++i)
+                    collect_op_types(sub_graph_node->get_function(i), types);
+            }
+        }
+    }
+}
+
+// Extracts the node types a matcher root can trigger on, mirroring the dispatch
+// in GraphRewrite::apply_matcher_passes. Returns false when the root type is
+// unknown and the pass has to be tried on every node.
+bool get_matcher_root_types(const std::shared_ptr<ov::pass::MatcherPass>& pass, std::vector<ov::NodeTypeInfo>& types) {
+    auto matcher = pass->get_matcher();
+    if (!matcher)
+        return false;
+    auto root = matcher->get_pattern_value().get_node_shared_ptr();
+    if (auto any_output = std::dynamic_pointer_cast<ov::pass::pattern::op::AnyOutput>(root))
+        root = any_output->input_value(0).get_node_shared_ptr();
+    if (auto p = std::dynamic_pointer_cast<ov::pass::pattern::op::Pattern>(root)) {
+        if (auto wrap_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(p)) {
+            types = wrap_type->get_wrapped_types();
+            return true;
+        }
+        return false;
+    }
+    types.push_back(root->get_type_info());
+    return true;
+}
+
+uint64_t timestamp_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Appends the profiling info of one run_passes call to a chrome-trace file, so the pipelines
+// executed during a whole model compilation can be viewed on one timeline. The trace-event
+// format tolerates a missing closing bracket, which allows appending from several pipelines
+// without a process-exit hook.
+void append_chrome_trace(const std::string& path,
+                         const std::vector<uint64_t>& start_timestamps_us,
+                         const std::vector<ov::pass::PassProfilingInfo>& info) {
+    static std::mutex trace_mutex;
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    std::ofstream trace(path, std::ios::app);
+    if (!trace)
+        return;
+    // the opening bracket is emitted only when the file is still empty, so several processes
+    // appending to one trace file do not corrupt it with a mid-stream '['
+    trace.seekp(0, std::ios::end);
+    if (trace.tellp() == std::ofstream::pos_type(0)) {
+        trace << "[\n";
+    }
+    const auto tid = std::hash<std::thread::id>()(std::this_thread::get_id()) % 1000000;
+    for (size_t i = 0; i < info.size(); ++i) {
+        trace << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << start_timestamps_us[i]
+              << ",\"dur\":" << info[i].microseconds << ",\"name\":\"" << info[i].name << "\"},\n";
+    }
+}
 }  // namespace
 
 ov::pass::Manager::Manager() : m_pass_config(std::make_shared<PassConfig>()), m_visualize(getenv_visualize_tracing()) {}
@@ -63,9 +139,18 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     NGRAPH_SUPPRESS_DEPRECATED_START
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "pass::Manager::run_passes");
 
-    static bool profile_enabled =
+    static const bool profile_env =
         ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    static const std::string trace_path = ov::util::getenv_string("OV_PROFILE_PASS_TRACE");
+    const bool profile_enabled = m_profiling || profile_env;
 
+    m_profiling_info.clear();
+    std::vector<uint64_t> pass_start_timestamps;
+    // Inventory of the op types present in the model; lets the manager skip matcher
+    // passes whose trigger ops are absent without walking the graph. It stays valid
+    // across passes that don't change the model and is rebuilt lazily otherwise.
+    std::unordered_set<NodeTypeInfo> op_inventory;
+    bool op_inventory_valid = false;
     size_t index = 0;
     ngraph::stopwatch pass_timer;
     ngraph::stopwatch overall_timer;
@@ -73,7 +158,8 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     bool pass_applied = false;
     bool function_changed = false;
     bool needs_validate = false;
-    for (auto& pass : m_pass_list) {
+    for (size_t pass_idx = 0; pass_idx < m_pass_list.size(); ++pass_idx) {
+        auto& pass = m_pass_list[pass_idx];
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
             continue;
@@ -81,6 +167,14 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
 
+        pass_applied = false;
+        PassProfilingInfo profiling_entry;
+        uint64_t pass_start_us = 0;
+        if (profile_enabled) {
+            profiling_entry.name = pass->get_name();
+            profiling_entry.ops_before = func->get_ops().size();
+            pass_start_us = timestamp_us();
+        }
         pass_timer.start();
 
         if (auto matcher_pass = dynamic_pointer_cast<MatcherPass>(pass)) {
@@ -91,9 +185,60 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                              << "model is dynamic. Skipping this transformation";
                 continue;
             }
+            std::vector<NodeTypeInfo> root_types;
+            if (get_matcher_root_types(matcher_pass, root_types)) {
+                if (!op_inventory_valid) {
+                    op_inventory.clear();
+                    collect_op_types(func, op_inventory);
+                    op_inventory_valid = true;
+                }
+                const bool can_match = std::any_of(root_types.begin(), root_types.end(), [&](const NodeTypeInfo& t) {
+                    return op_inventory.count(t) != 0;
+                });
+                if (!can_match) {
+                    NGRAPH_DEBUG << "Pass " << pass->get_name() << " is skipped as the model "
+                                 << "contains no operation its pattern can match";
+                    continue;
+                }
+            }
             // GraphRewrite is a temporary container for MatcherPass to make execution
-            // on on entire ngraph::Function
-            pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+            // on on entire ngraph::Function. Folding several neighbouring passes into one
+            // container saves graph traversals, but a shared sweep dispatches at most one
+            // matcher per node and revisits callback-created nodes only when the callback
+            // calls register_new_node, so the folded passes do not observe each other's
+            // fully transformed graph. Folding is therefore strictly opt-in: only passes
+            // that declare PassProperty::ORDER_INSENSITIVE may be folded, and only with
+            // each other. Everything else keeps the one-sweep-per-pass semantics.
+            const auto is_foldable = [](const std::shared_ptr<PassBase>& p) {
+                const auto mp = dynamic_pointer_cast<MatcherPass>(p);
+                return mp != nullptr && mp->get_property(PassProperty::ORDER_INSENSITIVE);
+            };
+            if (is_foldable(pass) && pass_idx + 1 < m_pass_list.size() && is_foldable(m_pass_list[pass_idx + 1])) {
+                GraphRewrite batch;
+                batch.set_pass_config(m_pass_config);
+                batch.add_matcher(matcher_pass);
+                std::string batch_name = pass->get_name();
+                while (pass_idx + 1 < m_pass_list.size()) {
+                    const auto& next = m_pass_list[pass_idx + 1];
+                    if (m_pass_config->is_disabled(next->get_type_info())) {
+                        // consumed by the batch, filtered out again inside the sweep
+                        ++pass_idx;
+                        continue;
+                    }
+                    if (!is_foldable(next))
+                        break;
+                    batch.add_matcher(dynamic_pointer_cast<MatcherPass>(next));
+                    batch_name += "+" + next->get_name();
+                    ++pass_idx;
+                }
+                // a folded sweep is profiled as one unit under the combined name; profiling
+                // must never change which transformations run or how they are grouped
+                if (profile_enabled)
+                    profiling_entry.name = batch_name;
+                pass_applied = batch.run_on_model(func);
+            } else {
+                pass_applied = GraphRewrite(matcher_pass).run_on_model(func);
+            }
         } else if (auto function_pass = dynamic_pointer_cast<ModelPass>(pass)) {
             // This checks is to skip the graph transformation when the graph pass relies on
             // static shape but the function state is dynamic.
@@ -103,6 +248,12 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 continue;
             }
 
+            // Model-wide validation is batched here rather than done inside the rewrites:
+            // a whole GraphRewrite sweep counts as one pass, so its matcher callbacks
+            // trigger at most one Validate between passes no matter how many patterns
+            // fired. Nodes created inside callbacks are still validated on construction -
+            // that is what lets a later callback in the same sweep rely on the output
+            // types of nodes an earlier one produced, so it must not be deferred.
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (needs_validate) {
                     function_pass->run_on_model(func);
@@ -110,6 +261,10 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
                 }
             } else {
                 pass_applied = function_pass->run_on_model(func);
+                // The return value of a ModelPass cannot be trusted for cache invalidation:
+                // wrapper passes like CommonOptimizations mutate the model heavily and
+                // deliberately return false. Only matcher sweeps report changes truthfully.
+                op_inventory_valid = false;
             }
         } else if (auto node_pass = dynamic_pointer_cast<ngraph::pass::NodePass>(pass)) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
@@ -120,6 +275,7 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             for (const shared_ptr<Node>& n : func->get_ops()) {
                 pass_applied |= node_pass->run_on_node(n);
             }
+            op_inventory_valid = false;
         }
 
         if (m_visualize) {
@@ -138,13 +294,25 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         index++;
         pass_timer.stop();
         if (profile_enabled) {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            profiling_entry.microseconds = pass_timer.get_microseconds();
+            profiling_entry.ops_after = func->get_ops().size();
+            profiling_entry.applied = pass_applied;
+            m_profiling_info.push_back(profiling_entry);
+            pass_start_timestamps.push_back(pass_start_us);
+            // stdout report is tied to the environment variable not to spam programmatic users
+            if (profile_env)
+                cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
         function_changed = function_changed || pass_applied;
         needs_validate = pass_applied;
+        if (pass_applied)
+            op_inventory_valid = false;
     }
     if (profile_enabled) {
-        cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        if (profile_env)
+            cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        if (!trace_path.empty())
+            append_chrome_trace(trace_path, pass_start_timestamps, m_profiling_info);
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
 
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <fstream>
 #include <openvino/cc/pass/itt.hpp>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -1217,7 +1218,9 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
 
     // IR
     hdr.model_offset = m_stream.tellp();
-    xml_doc.save(m_stream);
+    // The stream is consumed by the IR frontend only, so skip pretty-printing:
+    // raw output is smaller and both saving and re-parsing are faster
+    xml_doc.save(m_stream, "", pugi::format_raw);
     m_stream.flush();
 
     const size_t file_size = m_stream.tellp();
@@ -1255,14 +1258,45 @@ public:
     std::streamsize xsputn(const char* s, std::streamsize n) override {
         auto* intS = (const std::streamsize*)s;
         std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+
+        // Weight blobs arrive here as single multi-megabyte writes. The running sum is
+        // associative, so such buffers are split between threads and the partial sums are
+        // added up - the result is bit-identical to the sequential one, and hashing a big
+        // model is no longer limited by one core
+        constexpr std::streamsize min_words_per_thread = (1 << 22) / sizeof(std::streamsize);
+        const auto max_threads = static_cast<std::streamsize>(std::thread::hardware_concurrency());
+        const std::streamsize num_threads = std::min(max_threads, n64 / min_words_per_thread);
+        if (num_threads > 1) {
+            std::vector<std::streamsize> partial_sums(num_threads, 0);
+            std::vector<std::thread> workers;
+            const std::streamsize words_per_thread = n64 / num_threads;
+            for (std::streamsize t = 0; t < num_threads; ++t) {
+                const auto* begin = intS + t * words_per_thread;
+                const auto* end = (t + 1 == num_threads) ? intS + n64 : begin + words_per_thread;
+                workers.emplace_back([begin, end, t, &partial_sums] {
+                    std::streamsize sum = 0;
+                    for (const auto* p = begin; p != end; ++p) {
+                        sum += *p;
+                    }
+                    partial_sums[t] = sum;
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            for (const auto& sum : partial_sums) {
+                m_res += sum;
+            }
+        } else {
+            std::streamsize i = 0;
+            // Using 64-bit values executes much faster than char
+            while (i++ < n64) {
+                m_res += *(intS++);
+            }
         }
 
         std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
+        for (std::streamsize i = 0; i < rest; i++) {
             m_res += s[n - rest + i];
         }
         return n;
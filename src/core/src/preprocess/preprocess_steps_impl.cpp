@@ -52,6 +52,14 @@ static std::string vector_to_string(const std::vector<T>& values) {
     return s.str();
 }
 
+// Mean/scale are inserted as plain Subtract/Divide nodes on purpose. Scale reaches the
+// first Convolution/MatMul weights through the common pipelines every plugin runs
+// (MultiplyConvolutionFusion, MatMulMultiplyFusion, LinOpSequenceFusion), so no extra
+// kernel is executed there. Mean cannot be folded into weights as a guarantee: with
+// non-zero padding conv(x - mean) differs from conv(x) + bias at the borders, so a
+// forced push would silently change results; where it is legal the same pipelines
+// already do it. Layout conversion stays a Transpose node, which plugins merge into
+// the input reorder they emit anyway.
 void PreStepsList::add_scale_impl(const std::vector<float>& values) {
     m_actions.emplace_back(
         [values](const std::vector<Output<Node>>& nodes,
@@ -79,3 +79,17 @@ TEST(BoundEvaluatorTest, no_exception_on_single_bound) {
     ASSERT_NO_THROW(sub->evaluate_upper(output));
     EXPECT_EQ(o_[0], 10);
 }
+
+TEST(BoundEvaluatorTest, shared_bounds_on_fully_determined_subgraph) {
+    const auto p = std::make_shared<Parameter>(element::f32, PartialShape{2, 3});
+    const auto shape = std::make_shared<ShapeOf>(p);
+    const auto add = std::make_shared<Add>(shape, Constant::create(element::i64, Shape{2}, {1, 1}));
+
+    const auto bounds = evaluate_both_bounds(add);
+    ASSERT_TRUE(bounds.first && bounds.second);
+    // all input bounds are point values, so the bounds must be one shared tensor,
+    // not two equal copies produced by separate evaluations
+    EXPECT_EQ(bounds.first.data(), bounds.second.data());
+    EXPECT_EQ(bounds.first.data<int64_t>()[0], 3);
+    EXPECT_EQ(bounds.first.data<int64_t>()[1], 4);
+}
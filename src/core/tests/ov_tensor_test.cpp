@@ -306,6 +306,25 @@ TEST_F(OVTensorTest, makeRangeRoiTensor) {
     ASSERT_EQ(roi_tensor.get_element_type(), t.get_element_type());
 }
 
+TEST_F(OVTensorTest, makeOuterDimRoiTensorIsContinuous) {
+    ov::Tensor t{ov::element::f32, {8, 3, 4, 5}};
+    ov::Tensor roi_tensor{t, {2, 0, 0, 0}, {5, 3, 4, 5}};
+    ov::Shape ref_shape = {3, 3, 4, 5};
+    ptrdiff_t ref_offset_elems = 2 * 3 * 4 * 5;
+    ASSERT_EQ(roi_tensor.get_shape(), ref_shape);
+    ASSERT_EQ(roi_tensor.data<float>() - t.data<float>(), ref_offset_elems);
+    // outer-dimension slice of a dense tensor keeps default strides for its shape
+    ASSERT_EQ(byteStrides(ov::row_major_strides(ref_shape), roi_tensor.get_element_type()), roi_tensor.get_strides());
+    ASSERT_TRUE(roi_tensor.is_continuous());
+}
+
+TEST_F(OVTensorTest, makeInnerDimRoiTensorIsNotContinuous) {
+    ov::Tensor t{ov::element::f32, {8, 3, 4, 5}};
+    ov::Tensor roi_tensor{t, {0, 0, 1, 0}, {8, 3, 3, 5}};
+    ASSERT_EQ(roi_tensor.get_shape(), ov::Shape({8, 3, 2, 5}));
+    ASSERT_FALSE(roi_tensor.is_continuous());
+}
+
 TEST_F(OVTensorTest, cannotSetShapeOnRoiTensor) {
     ov::Tensor t{ov::element::i32, {1, 3, 6, 5}};  // RGBp picture of size (WxH) = 5x6
     ov::Tensor roi_tensor{t, {0, 0, 1, 2}, {1, 3, 5, 4}};
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/packed_string_tensor.hpp"
+
+#include <gtest/gtest.h>
+
+#include "openvino/core/except.hpp"
+
+TEST(packed_string_tensor, pack_unpack_round_trip) {
+    const std::vector<std::string> strings = {"OpenVINO", "", "packed string tensor", "\xd0\xbf\xd1\x80"};
+    const auto packed = ov::pack_strings(strings);
+    EXPECT_EQ(packed.get_element_type(), ov::element::u8);
+    EXPECT_EQ(packed.get_shape().size(), 1);
+    size_t total_bytes = 0;
+    for (const auto& s : strings)
+        total_bytes += s.size();
+    EXPECT_EQ(packed.get_byte_size(), 4 * (strings.size() + 1) + total_bytes);
+    EXPECT_EQ(ov::unpack_strings(packed), strings);
+}
+
+TEST(packed_string_tensor, pack_unpack_empty_batch) {
+    const auto packed = ov::pack_strings({});
+    EXPECT_EQ(packed.get_byte_size(), 4);
+    EXPECT_TRUE(ov::unpack_strings(packed).empty());
+}
+
+TEST(packed_string_tensor, unpack_rejects_malformed_input) {
+    EXPECT_THROW(ov::unpack_strings(ov::Tensor(ov::element::f32, ov::Shape{4})), ov::Exception);
+    EXPECT_THROW(ov::unpack_strings(ov::Tensor(ov::element::u8, ov::Shape{2, 2})), ov::Exception);
+    EXPECT_THROW(ov::unpack_strings(ov::Tensor(ov::element::u8, ov::Shape{2})), ov::Exception);
+
+    // batch size claims more offsets than the tensor holds
+    ov::Tensor truncated(ov::element::u8, ov::Shape{8});
+    *reinterpret_cast<int32_t*>(truncated.data()) = 4;
+    EXPECT_THROW(ov::unpack_strings(truncated), ov::Exception);
+
+    // negative batch size must be rejected, not wrapped around by the size_t cast
+    ov::Tensor negative_batch(ov::element::u8, ov::Shape{8});
+    *reinterpret_cast<int32_t*>(negative_batch.data()) = -1;
+    EXPECT_THROW(ov::unpack_strings(negative_batch), ov::Exception);
+
+    // end offset points past the byte area
+    ov::Tensor bad_offset(ov::element::u8, ov::Shape{10});
+    auto* header = reinterpret_cast<int32_t*>(bad_offset.data());
+    header[0] = 1;
+    header[1] = 42;
+    EXPECT_THROW(ov::unpack_strings(bad_offset), ov::Exception);
+}
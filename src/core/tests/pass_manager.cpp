@@ -42,3 +42,21 @@ public:
     }
 };
 }  // namespace
+
+TEST(pass_manager, profiling_info) {
+    pass::Manager pass_manager;
+    pass_manager.register_pass<DummyPass>();
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    EXPECT_TRUE(pass_manager.get_profiling_info().empty());
+
+    pass_manager.set_profiling(true);
+    pass_manager.run_passes(graph);
+    // the per-pass validation adds a Validate entry after the registered pass
+    const auto& info = pass_manager.get_profiling_info();
+    ASSERT_EQ(info.size(), 2);
+    EXPECT_NE(info[0].name.find("DummyPass"), std::string::npos);
+    EXPECT_FALSE(info[0].applied);
+    EXPECT_EQ(info[0].ops_before, info[0].ops_after);
+}
@@ -6,6 +6,8 @@
 
 #include <pugixml.hpp>
 #include <regex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ie_ngraph_utils.hpp"
 #include "meta_data.hpp"
@@ -422,14 +424,14 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         GenericLayerParams params;
     };
 
-    std::map<size_t /*layer-id*/, NodeParams> params;
+    std::unordered_map<size_t /*layer-id*/, NodeParams> params;
 
     std::vector<size_t /*layer-id*/> outputs;
     std::unordered_set<std::string> opName;
 
     std::vector<size_t> order;
-    std::set<size_t> dfs_used_nodes;
-    std::map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
+    std::unordered_set<size_t> dfs_used_nodes;
+    std::unordered_map<size_t /*to-layer-id*/, std::vector<Edge>> edges;
     // Read all layers and store their parameters in params map
     FOREACH_CHILD (node, root.child("layers"), "layer") {
         auto node_param = parse_generic_params(node);
@@ -458,24 +460,40 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         edges[toLayer].push_back({fromLayer, fromPort, toPort});
     }
 
-    // Run DFS starting from outputs to get nodes topological order
-    std::function<void(size_t)> dfs = [&edges, &order, &dfs_used_nodes, &dfs](const size_t id) {
-        if (dfs_used_nodes.count(id))
+    // Run DFS starting from outputs to get nodes topological order.
+    // The traversal is iterative, so graphs with very long chains of layers
+    // do not overflow the call stack.
+    std::vector<std::pair<size_t /*layer-id*/, size_t /*next-edge*/>> dfs_stack;
+    auto dfs = [&edges, &order, &dfs_used_nodes, &dfs_stack](const size_t id) {
+        if (!dfs_used_nodes.insert(id).second)
             return;
-        dfs_used_nodes.insert(id);
-        for (auto& edge : edges[id]) {
-            dfs(edge.fromLayerId);
+        dfs_stack.emplace_back(id, 0);
+        while (!dfs_stack.empty()) {
+            const size_t cur_id = dfs_stack.back().first;
+            const auto& cur_edges = edges[cur_id];
+            const size_t edge_idx = dfs_stack.back().second;
+            if (edge_idx < cur_edges.size()) {
+                ++dfs_stack.back().second;
+                const size_t from_id = cur_edges[edge_idx].fromLayerId;
+                if (dfs_used_nodes.insert(from_id).second)
+                    dfs_stack.emplace_back(from_id, 0);
+            } else {
+                order.push_back(cur_id);
+                dfs_stack.pop_back();
+            }
         }
-        order.push_back(id);
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
-    std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    std::unordered_map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
+    func_nodes.all.reserve(order.size());
+    id_to_node.reserve(order.size());
+
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
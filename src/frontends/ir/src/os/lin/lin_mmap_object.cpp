@@ -9,7 +9,10 @@
 #include <unistd.h>
 
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <utility>
 
 #include "mmap_object.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
@@ -97,9 +100,36 @@ public:
     }
 };
 
+namespace {
+
+// One weights file is commonly referenced by several models (e.g. an encoder and a
+// decoder exported side by side share one .bin), so the read-only mappings are pooled
+// per file: while a mapping is still alive, a repeated load_mmap_object() on the same
+// file returns it instead of mapping a second copy of the pages. The key is the
+// device/inode pair, which identifies the file regardless of the path it was reached
+// through. Expired entries are left behind and reused as slots on the next load.
+std::mutex map_holder_cache_mutex;
+std::map<std::pair<dev_t, ino_t>, std::weak_ptr<MapHolder>> map_holder_cache;
+
+}  // namespace
+
 std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
-    auto holder = std::make_shared<MapHolder>();
-    holder->set(path);
+    std::shared_ptr<MapHolder> holder;
+    struct stat sb = {};
+    if (stat(path.c_str(), &sb) == 0) {
+        const auto identity = std::make_pair(sb.st_dev, sb.st_ino);
+        std::lock_guard<std::mutex> lock(map_holder_cache_mutex);
+        holder = map_holder_cache[identity].lock();
+        if (!holder) {
+            holder = std::make_shared<MapHolder>();
+            holder->set(path);
+            map_holder_cache[identity] = holder;
+        }
+    } else {
+        // let set() fail with the usual diagnostics
+        holder = std::make_shared<MapHolder>();
+        holder->set(path);
+    }
     return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
                                                                                        holder->size(),
                                                                                        holder);
@@ -2,6 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <map>
+#include <mutex>
+
 #include "mmap_object.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/util/file_util.hpp"
@@ -123,9 +126,34 @@ private:
     HandleHolder m_mapping;
 };
 
+namespace {
+
+// One weights file is commonly referenced by several models (e.g. an encoder and a
+// decoder exported side by side share one .bin), so the read-only mappings are pooled:
+// while a mapping is still alive, a repeated load_mmap_object() on the same file
+// returns it instead of mapping a second view of the pages. Unlike the Linux
+// implementation there is no cheap file identity check before the file is opened,
+// so the pool is keyed by the path as given. Expired entries are left behind and
+// reused as slots on the next load.
+std::mutex map_holder_cache_mutex;
+std::map<std::string, std::weak_ptr<MapHolder>> map_holder_cache;
+
+template <typename T>
+std::shared_ptr<MapHolder> get_map_holder(const std::string& key, const T& path) {
+    std::lock_guard<std::mutex> lock(map_holder_cache_mutex);
+    auto holder = map_holder_cache[key].lock();
+    if (!holder) {
+        holder = std::make_shared<MapHolder>();
+        holder->set(path);
+        map_holder_cache[key] = holder;
+    }
+    return holder;
+}
+
+}  // namespace
+
 std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
-    auto holder = std::make_shared<MapHolder>();
-    holder->set(path);
+    auto holder = get_map_holder(path, path);
     return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
                                                                                        holder->size(),
                                                                                        holder);
@@ -134,8 +162,7 @@ std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::stri
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path) {
-    auto holder = std::make_shared<MapHolder>();
-    holder->set(path);
+    auto holder = get_map_holder(ov::util::wstring_to_string(path), path);
     return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
                                                                                        holder->size(),
                                                                                        holder);
@@ -354,6 +354,111 @@ TEST_P(IRFrontendMMapTests, model_with_weights_reading_from_disk) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+TEST_P(IRFrontendMMapTests, model_with_weights_reading_with_read_model_property) {
+    std::string xmlModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="value1" type="Const" version="opset1">
+            <data element_type="i64" offset="0" shape="4" size="32"/>
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="Transpose0321" type="Transpose" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::vector<unsigned char> buffer(32, 0);
+    uint64_t* uint64Buffer = reinterpret_cast<uint64_t*>(buffer.data());
+    uint64Buffer[0] = 0;
+    uint64Buffer[1] = 3;
+    uint64Buffer[2] = 2;
+    uint64Buffer[3] = 1;
+
+    createTemporalModelFile(xmlModel, buffer);
+
+    std::shared_ptr<ov::Model> model;
+
+    // The per-call property must override the core-level setting
+    ov::Core new_core;
+    new_core.set_property(ov::enable_mmap(!GetParam()));
+    ASSERT_NO_THROW(model = new_core.read_model(xmlFileName, binFileName, ov::enable_mmap(GetParam())));
+    ASSERT_TRUE(!!model);
+
+    std::shared_ptr<ov::Model> modelRef;
+    {
+        auto parameter = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 3, 22, 22});
+        parameter->set_friendly_name("input");
+        auto constant =
+            std::make_shared<ov::opset1::Constant>(ov::element::i64, ov::Shape{4}, std::vector<uint64_t>{0, 3, 2, 1});
+        constant->set_friendly_name("value1");
+        auto transpose = std::make_shared<ov::opset1::Transpose>(parameter, constant);
+        transpose->set_friendly_name("Transpose0321");
+        auto result = std::make_shared<ov::opset1::Result>(transpose);
+        result->set_friendly_name("output");
+        modelRef = std::make_shared<ov::Model>(ov::NodeVector{result}, ov::ParameterVector{parameter});
+    }
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::RUNTIME_KEYS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
 INSTANTIATE_TEST_SUITE_P(EnableMMapPropery, IRFrontendMMapTests, ::testing::Bool());
 
 TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
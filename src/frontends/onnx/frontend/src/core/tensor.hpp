@@ -239,13 +239,16 @@ private:
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         size_t data_size = get_data_size();
         if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
+            // the buffer is a view into a mapping of the external data file, so the constant
+            // shares the mapped pages instead of holding its own copy of the data
+            const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+            auto external_data = tensor_external_data.load_external_mmap_data(m_model_dir);
+            if (shape_size(m_shape) * type.size() != external_data->size()) {
                 throw error::invalid_external_data(
                     "The size of the external data file does not match the byte size of an initializer '" + get_name() +
                     "' in the model");
             }
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
         } else if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
@@ -4,7 +4,10 @@
 
 #include "utils/tensor_external_data.hpp"
 
+#include <cstring>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -12,9 +15,79 @@
 #include "ngraph/log.hpp"
 #include "openvino/util/file_util.hpp"
 
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+namespace {
+#ifndef _WIN32
+// A read-only mapping of a whole external data file. The initializers hold sub-buffer views
+// into it, so however many tensors the file stores, it is mapped into the process only once
+// and its pages are loaded on the first access to the corresponding constant data
+class MappedExternalDataFile : public ngraph::runtime::AlignedBuffer {
+public:
+    explicit MappedExternalDataFile(const std::string& path) {
+        m_fd = open(path.c_str(), O_RDONLY);
+        if (m_fd == -1) {
+            throw ngraph_error("Can not open external data file: " + path);
+        }
+        struct stat sb = {};
+        if (fstat(m_fd, &sb) == -1) {
+            close(m_fd);
+            m_fd = -1;
+            throw ngraph_error("Can not get the size of external data file: " + path);
+        }
+        m_byte_size = static_cast<size_t>(sb.st_size);
+        if (m_byte_size > 0) {
+            auto data = mmap(nullptr, m_byte_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+            if (data == MAP_FAILED) {
+                close(m_fd);
+                m_fd = -1;
+                throw ngraph_error("Can not create a mapping of external data file: " + path);
+            }
+            m_allocated_buffer = static_cast<char*>(data);
+            m_aligned_buffer = m_allocated_buffer;
+        }
+    }
+
+    ~MappedExternalDataFile() override {
+        if (m_allocated_buffer != nullptr) {
+            munmap(m_allocated_buffer, m_byte_size);
+        }
+        if (m_fd != -1) {
+            close(m_fd);
+        }
+        // prevent the base class from freeing the already unmapped pointer
+        m_allocated_buffer = nullptr;
+        m_aligned_buffer = nullptr;
+        m_byte_size = 0;
+    }
+
+private:
+    int m_fd = -1;
+};
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_external_data_file(const std::string& path) {
+    // mappings of the files loaded by the models currently being imported are shared: the weak
+    // entries let a mapping be dropped as soon as the last constant referencing it is destroyed
+    static std::mutex mutex;
+    static std::map<std::string, std::weak_ptr<ngraph::runtime::AlignedBuffer>> mapped_files;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& weak_buffer = mapped_files[path];
+    auto buffer = weak_buffer.lock();
+    if (!buffer) {
+        buffer = std::make_shared<MappedExternalDataFile>(path);
+        weak_buffer = buffer;
+    }
+    return buffer;
+}
+#endif
+}  // namespace
 TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor) {
     for (const auto& entry : tensor.external_data()) {
         if (entry.key() == "location") {
@@ -69,6 +142,42 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
     return read_data;
 }
 
+TensorExternalData::Buffer TensorExternalData::load_external_mmap_data(const std::string& model_dir) const {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    auto full_path = file_util::path_join(model_dir, m_data_location);
+    NGRAPH_SUPPRESS_DEPRECATED_END
+#ifndef _WIN32
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> mapped;
+    try {
+        mapped = load_external_data_file(full_path);
+    } catch (const std::exception&) {
+        throw error::invalid_external_data{*this};
+    }
+    if (m_offset + m_data_length > mapped->size()) {
+        throw error::invalid_external_data{*this};
+    }
+    const uint64_t length = m_data_length > 0 ? m_data_length : mapped->size() - m_offset;
+    if (m_sha1_digest.size() > 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+        mapped->get_ptr<char>() + m_offset,
+        length,
+        mapped);
+#else
+    // no file mapping abstraction is available here for this platform,
+    // so read the requested part of the file into an allocated buffer instead
+    auto data = load_external_data(model_dir);
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer =
+        std::make_shared<ngraph::runtime::AlignedBuffer>(data.size());
+    std::memcpy(buffer->get_ptr(), data.data(), data.size());
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+        buffer->get_ptr<char>(),
+        buffer->size(),
+        buffer);
+#endif
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
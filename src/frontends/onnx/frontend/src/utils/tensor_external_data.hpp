@@ -6,12 +6,18 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <memory>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
+    using Buffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>;
+
     TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
     /// \brief      Load external data from tensor passed to constructor
@@ -23,6 +29,18 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Load external data as a shared buffer over a mapping of the data file
+    ///
+    /// \note       The whole data file is mapped once and shared between all the initializers
+    ///             stored in it, each getting a view into the mapping, so the data is paged in
+    ///             lazily by the OS instead of being read into a copied buffer upfront.
+    ///             On platforms without the file mapping support here the data is read into
+    ///             an allocated buffer instead. On failure the invalid_external_data exception
+    ///             is thrown.
+    ///
+    /// \return     External binary data as a buffer backed by the file mapping
+    Buffer load_external_mmap_data(const std::string& model_dir) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
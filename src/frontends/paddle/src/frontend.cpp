@@ -310,6 +310,11 @@ std::map<int32_t, std::shared_ptr<ov::Model>> FrontEnd::convert_each_node_recurs
     }
 
     // convert each sub block
+    // Sub blocks are converted eagerly on purpose, even the ones guarding rarely taken branches:
+    // TransformIf/TransformWhile turn them into the body models of If/Loop operations, which
+    // require complete ov::Model instances at construction time, and plugins compile every branch
+    // of the resulting graph. There is no channel for a plugin to request a block from the
+    // frontend later - the frontend library may already be unloaded once read_model returns.
     std::map<int32_t, std::shared_ptr<ov::Model>> block_funcs;
     block_funcs.insert({block_idx, main_block_func});
 
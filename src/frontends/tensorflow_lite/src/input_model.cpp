@@ -7,6 +7,7 @@
 #include <iterator>
 #include <queue>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
@@ -97,9 +98,18 @@ void InputModel::InputModelTFLiteImpl::load_model() {
                     // will reorder by index later
                     m_inputs.push_back(place);
                 } else if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    // alias the constant over the flatbuffer contents instead of copying the data
+                    // out of it; the shared buffer keeps the model content alive through the graph
+                    // iterator for as long as any of the constants created here lives
+                    const auto& shape = place->get_partial_shape().to_shape();
+                    const auto byte_size = ov::shape_size(shape) * place->get_element_type().size();
+                    auto buffer =
+                        std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<GraphIteratorFlatBuffer>>>(
+                            reinterpret_cast<char*>(const_cast<void*>(data)),
+                            byte_size,
+                            m_graph_iterator);
+                    auto constant =
+                        std::make_shared<ov::op::v0::Constant>(place->get_element_type(), shape, buffer);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
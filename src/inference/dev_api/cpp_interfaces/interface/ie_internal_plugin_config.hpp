@@ -88,6 +88,99 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines a directory where the CPU plugin persists reordered weights blobs between processes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_CACHE_DIR);
+
+/**
+ * @brief Shares identical reordered weights blobs between compiled models through a process-wide cache.
+ * Compiling the same model in several inference precisions (e.g. a bf16 model with an fp32 fallback
+ * variant) then keeps a single copy of the original constants; only the precision-specific reordered
+ * blobs are materialized per variant, on first use
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHARED_WEIGHTS_CACHE);
+
+/**
+ * @brief Lists input shapes the CPU plugin pre-builds dynamic-shape primitives for at compile time.
+ * Format: shape sets separated by '|', inputs within a set by ';', e.g. "data:1,3,224,224|data:8,3,224,224"
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_AOT_SHAPES);
+
+/**
+ * @brief Executes independent nodes of a static graph concurrently on the threads of one stream
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTRA_STREAM_PARALLELISM);
+
+/**
+ * @brief Clones read-only weights onto each stream's local NUMA node even when a single graph is compiled
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_NUMA_WEIGHTS_REPLICATION);
+
+/**
+ * @brief Backs large weight and activation allocations with 2MB huge pages when the kernel supports it
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_HUGE_PAGES);
+
+/**
+ * @brief Marks the cores reserved for this compiled model as busy in the process-wide CPU map, so
+ * models compiled later keep their stream threads off them; the cores return to the shared pool
+ * when the compiled model is destroyed
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EXCLUSIVE_CORES);
+
+/**
+ * @brief Lists model inputs whose content rarely changes between inference requests, separated by ';'.
+ * The CPU plugin memoizes the subgraph that depends only on these inputs (and constants): its results
+ * are kept between requests and recomputed only when the content of one of the listed inputs changes,
+ * which is detected by hashing them at the start of every request
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_QUASI_STATIC_INPUTS);
+
+/**
+ * @brief Names an activation-memory sharing domain for the compiled model. Models compiled into the
+ * same domain share one activation workspace sized to the largest of them, so a pipeline of stages
+ * that never run concurrently holds max-stage memory instead of the sum. The caller guarantees that
+ * the sharing models do not execute at the same time; compile the largest stage first for the best
+ * footprint
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ACTIVATIONS_SHARING_DOMAIN);
+
+/**
+ * @brief Pins the implementation choice per node, as a ';' separated list of NodeName:ImplType
+ * pairs where ImplType is the implementation name the execution graph reports (e.g. jit_avx512_1x1).
+ * Recording the execution graph of a reference run and replaying it through this key makes kernel
+ * selection reproducible across runs, so performance diffs reflect real changes. A pinned
+ * implementation the node does not support falls back to the regular selection order
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_IMPL_MANIFEST);
+
+/**
+ * @brief Sets the execution precision per node type, as a ';' separated list of NodeType:Precision
+ * pairs (e.g. Interpolate:BF16;Softmax:FP32). Listed types are pinned to the given precision in both
+ * directions - forced down to it or kept at it - overriding the global inference precision hint;
+ * unlisted types follow the hint as before
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_EXEC_PRECISION_POLICY);
+
+/**
+ * @brief Checks scratch memory out of a shared arena per execution instead of holding it per stream.
+ * Accepts YES/NO or a cap on the retained free memory in megabytes (implies YES)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SCRATCH_ARENA);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
@@ -110,6 +203,16 @@ DECLARE_CONFIG_VALUE(ENABLE);
 DECLARE_CONFIG_VALUE(IGNORE_CALLBACK);
 DECLARE_CONFIG_VALUE(DISABLE);
 
+/**
+ * @brief Defines the planner used to pack intermediate tensors into the shared memory blob
+ *      @param GREEDY_BY_SIZE - default planner, places the biggest boxes first lifting overlapping ones up
+ *      @param BEST_FIT - places each box into the tightest free gap between already placed overlapping boxes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(MEM_REUSE_STRATEGY);
+DECLARE_CONFIG_VALUE(GREEDY_BY_SIZE);
+DECLARE_CONFIG_VALUE(BEST_FIT);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -172,6 +172,67 @@ public:
         return _min_required;
     }
 
+    /**
+     * @brief Solve memory location placing each box into the tightest free gap
+     *        between the already placed boxes it overlaps in time (best-fit).
+     *        Unlike solve() a box is never lifted above a gap it fits into, which
+     *        usually gives a denser packing for graphs with many equally sized
+     *        boxes at the cost of an extra sort per box.
+     * @return Size of common memory blob required for storing all
+     */
+    int64_t solveBestFit() {
+        maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+        std::vector<std::vector<const Box*>> time_slots(_time_duration);
+        for (auto& slot : time_slots)
+            slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
+
+        // Sort be box size. First is biggest. Among equal sizes the longer living box
+        // goes first since it constrains more time slots and is harder to place later.
+        std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
+            return l.size > r.size || (l.size == r.size && l.finish - l.start > r.finish - r.start);
+        });
+
+        int64_t _min_required = 0;
+        std::vector<std::pair<int64_t, int64_t>> busy;  // [offset, offset + size) of overlapping boxes
+
+        for (Box& box : _boxes) {
+            int64_t id = box.id;
+
+            // collect occupied intervals of all placed boxes which share a time slot with this one
+            busy.clear();
+            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+                for (auto* box_in_slot : time_slots[i_slot])
+                    busy.emplace_back(box_in_slot->id, box_in_slot->id + box_in_slot->size);
+            std::sort(busy.begin(), busy.end());
+
+            // scan the gaps between busy intervals and remember the tightest fitting one
+            int64_t cursor = 0;
+            int64_t best_offset = -1, best_gap = -1;
+            for (const auto& interval : busy) {
+                if (interval.first > cursor) {
+                    const int64_t gap = interval.first - cursor;
+                    if (gap >= box.size && (best_gap == -1 || gap < best_gap)) {
+                        best_gap = gap;
+                        best_offset = cursor;
+                    }
+                }
+                cursor = std::max(cursor, interval.second);
+            }
+
+            // id will be used as a temp offset storage; no suitable gap means placing on top
+            box.id = best_offset == -1 ? cursor : best_offset;
+
+            // add current box to covered time slot
+            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
+                time_slots[i_slot].push_back(&box);
+
+            _min_required = std::max(_min_required, box.id + box.size);
+            _offsets[id] = box.id;
+        }
+
+        return _min_required;
+    }
+
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const {
         auto res = _offsets.find(id);
@@ -72,6 +72,22 @@ static const char LAYER_TYPE[] = "layerType";
  */
 static const char RUNTIME_PRECISION[] = "runtimePrecision";
 
+/**
+ * @ingroup ov_dev_exec_model
+ * @brief Used to get an estimate of bytes moved by the executable primitive: the sum of its input
+ *        and output memory sizes. Combined with PERF_COUNTER it gives the achieved bandwidth for
+ *        roofline-style analysis.
+ */
+static const char DATA_BYTES[] = "dataBytes";
+
+/**
+ * @ingroup ov_dev_exec_model
+ * @brief Used to get an estimate of floating point operations performed by the executable
+ *        primitive, computed from shapes for the compute-dominated primitive types. Combined with
+ *        PERF_COUNTER and DATA_BYTES it classifies a primitive as compute or bandwidth bound.
+ */
+static const char ESTIMATED_FLOPS[] = "estimatedFlops";
+
 /**
  * @ingroup ov_dev_exec_model
  * @brief The Execution node which is used to represent node in execution graph.
@@ -9,6 +9,9 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <future>
 #include <memory>
 
@@ -16,6 +19,7 @@
 #include "openvino/runtime/exception.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 
@@ -71,6 +75,46 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets scheduling priority of the request.
+     *        Takes effect when the request executor is a
+     *        ov::threading::PriorityTaskExecutor: stage tasks of this request are then
+     *        enqueued into the lane of the given priority and overtake queued tasks of
+     *        lower priority requests served by the same executor.
+     * @param priority Scheduling priority of the request
+     */
+    void set_priority(ov::hint::Priority priority);
+
+    /**
+     * @brief Gets scheduling priority of the request
+     * @return Scheduling priority of the request
+     */
+    ov::hint::Priority get_priority() const;
+
+    /**
+     * @brief Latency statistics accumulated over the lifetime of the request.
+     *
+     * Values are recorded into power-of-two microsecond buckets: bucket `i` counts inferences whose
+     * measured time fell into [2^i, 2^(i+1)) microseconds; bucket 0 also covers sub-microsecond
+     * values and the last bucket everything above its lower boundary.
+     */
+    struct LatencyStats {
+        static constexpr std::size_t BUCKETS = 32;
+        uint64_t count = 0;                            //!< Number of completed inferences
+        std::array<uint64_t, BUCKETS> durations{};     //!< Submit to completion time histogram
+        std::array<uint64_t, BUCKETS> queue_delays{};  //!< Submit to first stage start time histogram
+    };
+
+    /**
+     * @brief Gets a snapshot of latency statistics of this request.
+     *
+     * Statistics are always on: recording is a couple of relaxed atomic increments per inference,
+     * so the snapshot may be taken at any rate while inferences are in flight. Per compiled model
+     * statistics are obtained by element-wise summation of the snapshots of its requests.
+     * @return Histograms of pipeline latencies accumulated since the request was created.
+     */
+    LatencyStats get_latency_stats() const;
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -219,6 +263,9 @@ private:
                                              const Pipeline::iterator itEndStage,
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor);
 
+    void record_queue_delay();
+    void record_duration();
+
     template <typename F>
     void infer_impl(const F& f) {
         check_tensors();
@@ -272,6 +319,14 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::function<void(std::exception_ptr)> m_callback;
+    ov::hint::Priority m_priority = ov::hint::Priority::DEFAULT;
+
+    // Only one inference is in flight per request (enforced by InferState::BUSY), so the submit
+    // timestamp is a plain member: the executor task queue orders the write against the reads
+    std::chrono::steady_clock::time_point m_submit_time;
+    std::atomic<uint64_t> m_infer_count{0};
+    std::array<std::atomic<uint64_t>, LatencyStats::BUCKETS> m_duration_buckets{};
+    std::array<std::atomic<uint64_t>, LatencyStats::BUCKETS> m_queue_delay_buckets{};
 };
 
 }  // namespace ov
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "openvino/core/any.hpp"
 #include "openvino/core/shape.hpp"
@@ -19,6 +20,8 @@
 
 namespace ov {
 
+struct StagingTensorPool;
+
 class OPENVINO_RUNTIME_API IRemoteContext : public std::enable_shared_from_this<IRemoteContext> {
 public:
     /**
@@ -61,6 +64,22 @@ public:
      * @return A tensor instance with device friendly memory.
      */
     virtual std::shared_ptr<ov::ITensor> create_host_tensor(const ov::element::Type type, const ov::Shape& shape);
+
+    /**
+     * @brief Acquires a host staging tensor for host<->device transfers.
+     * Buffers are drawn from a per-context pool with power-of-two size classes and are backed by
+     * create_host_tensor(), so a device specific context serves device friendly (e.g. USM/pinned)
+     * memory and copies run at full bus bandwidth instead of pageable-memory speed.
+     * Releasing the returned tensor puts its buffer back into the pool instead of freeing it.
+     * @param type Tensor element type.
+     * @param shape Tensor shape.
+     * @return A tensor instance over a pooled staging buffer.
+     */
+    std::shared_ptr<ov::ITensor> acquire_staging_tensor(const ov::element::Type& type, const ov::Shape& shape);
+
+private:
+    std::once_flag m_staging_pool_once;
+    std::shared_ptr<StagingTensorPool> m_staging_pool;
 };
 
 }  // namespace ov
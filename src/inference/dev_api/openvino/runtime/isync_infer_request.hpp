@@ -10,8 +10,11 @@
 #pragma once
 
 #include <exception>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "openvino/core/descriptor/tensor.hpp"
@@ -154,6 +157,11 @@ private:
     std::shared_ptr<const ov::ICompiledModel> m_compiled_model;
     // Mutable to return reference to ov::Tensor
     mutable std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor> m_tensors;
+    // Memoized find_port results; the compiled model's ports are immutable, so entries never go stale
+    mutable std::map<std::pair<const ov::Node*, size_t>, FoundPort> m_cached_ports;
+    mutable std::mutex m_cached_ports_mutex;
+    // Dropped whenever a tensor appears through a path that does not validate it on the way in
+    mutable bool m_tensors_validated = false;
     ov::Tensor& get_ref_tensor(const ov::Output<const ov::Node>& port) const;
 
     /**
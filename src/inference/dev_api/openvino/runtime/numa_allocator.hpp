@@ -0,0 +1,72 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file openvino/runtime/numa_allocator.hpp
+ * @brief A header file for OpenVINO NUMA-aware host memory allocator
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include "openvino/runtime/common.hpp"
+
+namespace ov {
+
+/**
+ * @brief NUMA-aware host memory allocator.
+ *        Allocated pages are first-touched on the requested NUMA node, so on a
+ *        first-touch placement policy (default on Linux) they are physically backed
+ *        by that node. Wrap it into ov::Allocator to create tensors whose data lives
+ *        next to the stream that consumes them:
+ *        `ov::Tensor tensor{type, shape, ov::Allocator{NumaNodeAllocator{numa_node_id}}}`.
+ *        The NUMA node of a stream can be obtained via IStreamsExecutor::get_numa_node_id().
+ * @ingroup ov_dev_api
+ */
+class OPENVINO_RUNTIME_API NumaNodeAllocator {
+public:
+    /**
+     * @brief Sentinel NUMA node id which keeps the first touch on the calling thread,
+     *        placing the data on whatever node that thread runs on
+     */
+    static constexpr int current_thread_node = -1;
+
+    /**
+     * @brief Constructs the allocator for the given NUMA node
+     * @param numa_node_id NUMA node to place the allocations on; current_thread_node
+     *        places them on the node of the thread that calls allocate()
+     */
+    explicit NumaNodeAllocator(int numa_node_id = current_thread_node) : m_numa_node_id{numa_node_id} {}
+
+    /**
+     * @brief Allocates and first-touches the memory block
+     * @param bytes The size in bytes to allocate
+     * @param alignment The alignment of the storage
+     * @return Handle to the allocated resource
+     */
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t));
+
+    /**
+     * @brief Releases the handle previously returned by allocate()
+     * @param handle The handle to free
+     * @param bytes The size in bytes that was passed into allocate()
+     * @param alignment The alignment of storage that was passed into allocate()
+     */
+    void deallocate(void* handle, const size_t bytes, const size_t alignment = alignof(max_align_t));
+
+    /**
+     * @brief Compares with the other NumaNodeAllocator
+     * @param other The allocator to compare with
+     * @return `true` if memory allocated by one allocator can be freed by the other
+     */
+    bool is_equal(const NumaNodeAllocator& other) const {
+        return true;
+    }
+
+private:
+    int m_numa_node_id;
+};
+
+}  // namespace ov
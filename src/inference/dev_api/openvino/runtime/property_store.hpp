@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file openvino/runtime/property_store.hpp
+ * @brief A header file for array-indexed storage of runtime-queried properties
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "openvino/core/any.hpp"
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+/**
+ * @brief Resolves a property name into a process-wide integer id.
+ * Ids are assigned sequentially on first use and are stable for the process lifetime,
+ * so a hot call site can resolve its key once (typically into a function-local static)
+ * and then use array-indexed storage instead of a string map lookup per query.
+ * @param name Property name to resolve
+ * @return Integer id of the property
+ * @ingroup ov_dev_api
+ */
+OPENVINO_RUNTIME_API size_t property_id(const std::string& name);
+
+/**
+ * @brief Array-indexed storage for runtime-queried properties.
+ * A plugin fills the store once while applying its configuration; afterwards hot-path
+ * reads by a cached id cost one bounds check and one array index, with no string
+ * hashing and no map traversal. The store is not synchronized: concurrent reads are
+ * safe only while no set() is running.
+ * @ingroup ov_dev_api
+ */
+class OPENVINO_RUNTIME_API PropertyStore {
+public:
+    /**
+     * @brief Stores the value of the given property key, resolving its id by name
+     * @param property Property key
+     * @param value Property value
+     */
+    template <typename T, PropertyMutability M>
+    void set(const Property<T, M>& property, const T& value) {
+        set(property_id(property.name()), Any{value});
+    }
+
+    /**
+     * @brief Stores the value under the id obtained from property_id()
+     * @param id Property id
+     * @param value Property value
+     */
+    void set(size_t id, Any value);
+
+    /**
+     * @brief Returns the stored value; throws if the property was not set
+     * @param id Property id obtained from property_id()
+     * @return Stored property value
+     */
+    const Any& get(size_t id) const;
+
+    /**
+     * @brief Checks whether a value is stored under the id
+     * @param id Property id obtained from property_id()
+     * @return `true` if the property was set
+     */
+    bool has(size_t id) const;
+
+private:
+    std::vector<Any> m_values;
+};
+
+}  // namespace ov
@@ -101,6 +101,8 @@ public:
         int _threads_per_stream_small = 0;  //!< Threads per stream in small cores
         int _small_core_offset = 0;         //!< Calculate small core start offset when binding cpu cores
         bool _enable_hyper_thread = true;   //!< enable hyper thread
+        float _max_utilization = 1.0f;      //!< Fraction of CPU time the streams may consume, 1.0 means no
+                                            //!< throttling (ov::hint::max_utilization)
         int _plugin_task = NOT_USED;
         std::vector<std::vector<int>> _orig_proc_type_table;
         std::vector<std::vector<int>> _proc_type_table;
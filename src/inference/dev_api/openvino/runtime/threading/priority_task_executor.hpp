@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file openvino/runtime/threading/priority_task_executor.hpp
+ * @brief A header file for OpenVINO Priority Task Executor implementation
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace threading {
+
+/**
+ * @brief Decorates an ITaskExecutor with priority lanes.
+ *        Submitted tasks are buffered in per-priority queues and handed to the
+ *        underlying executor one by one, so a task enqueued with
+ *        ov::hint::Priority::HIGH overtakes tasks still queued with a lower
+ *        priority. Tasks that already started are never interrupted.
+ * @ingroup ov_dev_api_threading
+ */
+class OPENVINO_RUNTIME_API PriorityTaskExecutor : public ITaskExecutor {
+public:
+    /**
+     * @brief A shared pointer to PriorityTaskExecutor object
+     */
+    using Ptr = std::shared_ptr<PriorityTaskExecutor>;
+
+    /**
+     * @brief Constructs the executor on top of an existing one
+     * @param executor Underlying executor that actually runs the tasks
+     */
+    explicit PriorityTaskExecutor(std::shared_ptr<ITaskExecutor> executor);
+
+    ~PriorityTaskExecutor() override;
+
+    /**
+     * @brief Enqueues the task with ov::hint::Priority::DEFAULT priority
+     */
+    void run(Task task) override;
+
+    /**
+     * @brief Enqueues the task into the lane of the given priority
+     * @param task A task to run
+     * @param priority Scheduling priority of the task
+     */
+    void run(Task task, ov::hint::Priority priority);
+
+private:
+    struct Impl;
+    std::shared_ptr<Impl> _impl;
+};
+
+}  // namespace threading
+}  // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file openvino/runtime/threading/work_stealing_executor.hpp
+ * @brief A header file for OpenVINO Work Stealing Executor implementation
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+namespace ov {
+namespace threading {
+
+/**
+ * @brief Task executor with per-worker task queues and work stealing.
+ *        Tasks submitted via run() are distributed over the worker queues; a worker that
+ *        drains its own queue steals tasks from the busiest siblings instead of idling,
+ *        which keeps all cores busy under mixed-size task loads. Unlike CPUStreamsExecutor
+ *        the workers are not pinned, so the executor suits irregular node-level tasks
+ *        rather than stream-level inference work.
+ * @ingroup ov_dev_api_threading
+ */
+class OPENVINO_RUNTIME_API WorkStealingExecutor : public ITaskExecutor {
+public:
+    /**
+     * @brief A shared pointer to WorkStealingExecutor object
+     */
+    using Ptr = std::shared_ptr<WorkStealingExecutor>;
+
+    /**
+     * @brief Constructs the executor and starts the worker threads
+     * @param name Executor name used for thread naming
+     * @param threads Number of worker threads; values < 1 select the hardware concurrency
+     */
+    explicit WorkStealingExecutor(const std::string& name = "WorkStealingExecutor", int threads = 0);
+
+    /**
+     * @brief Drains the queues and joins the worker threads.
+     */
+    ~WorkStealingExecutor() override;
+
+    void run(Task task) override;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace threading
+}  // namespace ov
@@ -33,9 +33,12 @@ class ICompiledModel;
  * A model is compiled by a specific device by applying multiple optimization
  * transformations, then mapping to compute kernels.
  */
+struct InferRequestPool;
+
 class OPENVINO_RUNTIME_API CompiledModel {
     std::shared_ptr<ov::ICompiledModel> _impl;
     std::shared_ptr<void> _so;
+    std::shared_ptr<InferRequestPool> _request_pool;
 
     /**
      * @brief Constructs CompiledModel from the initialized std::shared_ptr.
@@ -147,6 +150,38 @@ public:
      */
     InferRequest create_infer_request();
 
+    /**
+     * @brief Acquires an infer request from the pool of released ones, creating a new request
+     * only when the pool is empty. Together with release_infer_request() this makes request
+     * acquisition on hot paths allocation-free: a recycled request keeps its tensors and
+     * internal state, so it is returned in O(1) without going through the plugin.
+     * The pool is shared between copies of this CompiledModel object.
+     *
+     * @return InferRequest object
+     */
+    InferRequest acquire_infer_request();
+
+    /**
+     * @brief Returns an idle request into the pool for reuse by acquire_infer_request().
+     * Waits for the request to complete if it is still running and drops its completion
+     * callback; input/output tensors are kept as is and may be overwritten by the next user.
+     *
+     * @param request Request created by this compiled model to recycle
+     */
+    void release_infer_request(InferRequest&& request);
+
+    /**
+     * @brief Runs a batch of prepared inference requests with a single synchronization point.
+     * All requests are submitted for asynchronous execution up front and the method returns
+     * when the last of them completes, which avoids the per-request wake-up/wait overhead of
+     * calling ov::InferRequest::infer in a loop when individual inferences are short.
+     * Input tensors of every request must be set before the call; requests must be idle.
+     *
+     * @param requests Requests created by create_infer_request() to run. If any request fails,
+     * the first raised exception is rethrown after the remaining started requests complete.
+     */
+    void infer_batch(std::vector<InferRequest>& requests);
+
     /**
      * @brief Exports the current compiled model to an output stream `std::ostream`.
      * The exported model can also be imported via the ov::Core::import_model method.
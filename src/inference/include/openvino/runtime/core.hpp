@@ -57,6 +57,20 @@ public:
      */
     explicit Core(const std::string& xml_config_file = {});
 
+    /** @brief Constructs an OpenVINO Core instance and optionally preloads all configured plugins.
+     *
+     * By default plugin libraries are opened lazily on first use of a device, so the first
+     * compile_model call pays for the library load and device enumeration. With @p preload_plugins
+     * set to `true` all registered plugins are loaded concurrently during Core construction
+     * instead. Plugins that fail to load (for example, because the device is absent on the
+     * machine) are skipped; the error is reported on explicit use of the device, as usual.
+     *
+     * @param xml_config_file Path to the .xml file with plugins to load from, same as in the
+     * single-argument constructor.
+     * @param preload_plugins Whether to eagerly load all registered plugins in parallel.
+     */
+    Core(const std::string& xml_config_file, bool preload_plugins);
+
     /**
      * @brief Returns device plugins version information.
      * Device name can be complex and identify multiple devices at once like `HETERO:CPU,GPU`;
@@ -80,9 +94,13 @@ public:
      *  * PDPD (*.pdmodel)
      *  * TF (*.pb)
      *  * TFLite (*.tflite)
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this read operation.
+     * For example, pass ov::enable_mmap(false) to disable memory mapping of the weights file for this call only.
      * @return A model.
      */
-    std::shared_ptr<ov::Model> read_model(const std::wstring& model_path, const std::wstring& bin_path = {}) const;
+    std::shared_ptr<ov::Model> read_model(const std::wstring& model_path,
+                                          const std::wstring& bin_path = {},
+                                          const ov::AnyMap& properties = {}) const;
 #endif
 
     /**
@@ -97,9 +115,37 @@ public:
      *  * PDPD (*.pdmodel)
      *  * TF (*.pb)
      *  * TFLite (*.tflite)
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this read operation.
+     * For example, pass ov::enable_mmap(false) to disable memory mapping of the weights file for this call only.
+     * @return A model.
+     */
+    std::shared_ptr<ov::Model> read_model(const std::string& model_path,
+                                          const std::string& bin_path = {},
+                                          const ov::AnyMap& properties = {}) const;
+
+    /**
+     * @brief Reads models from IR / ONNX / PDPD / TF / TFLite file formats.
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types.
+     * @param model_path Path to a model.
+     * @param bin_path Path to a data file.
+     * For IR format (*.bin):
+     *  * if `bin_path` is empty, will try to read a bin file with the same name as xml and
+     *  * if the bin file with the same name is not found, will load IR without weights.
+     * For the following file formats the `bin_path` parameter is not used:
+     *  * ONNX format (*.onnx)
+     *  * PDPD (*.pdmodel)
+     *  * TF (*.pb)
+     *  * TFLite (*.tflite)
+     * @param properties Optional pack of pairs: (property name, property value) relevant only for this read operation.
      * @return A model.
      */
-    std::shared_ptr<ov::Model> read_model(const std::string& model_path, const std::string& bin_path = {}) const;
+    template <typename... Properties>
+    util::EnableIfAllStringAny<std::shared_ptr<ov::Model>, Properties...> read_model(
+        const std::string& model_path,
+        const std::string& bin_path,
+        Properties&&... properties) const {
+        return read_model(model_path, bin_path, AnyMap{std::forward<Properties>(properties)...});
+    }
 
     /**
      * @brief Reads models from IR / ONNX / PDPD / TF / TFLite formats.
@@ -154,6 +200,11 @@ public:
      * Users can create as many compiled models as they need and use
      * them simultaneously (up to the limitation of the hardware resources).
      *
+     * The call blocks until compilation completes, but it is safe to run it on a worker
+     * thread (e.g. wrapped into std::async): Core is thread-safe and compilations of
+     * different models or for different devices proceed concurrently, so overlapping or
+     * abandoning them is the caller's scheduling decision.
+     *
      * @param model Model object acquired from Core::read_model.
      * @param device_name Name of a device to load a model to.
      * @param properties Optional map of pairs: (property name, property value) relevant only for this load
@@ -22,6 +22,13 @@ namespace ov {
  *
  * If the operation is executed using tiling, the sum time per each tile is indicated as the total execution time.
  * Due to parallel execution, the total execution time for all nodes might be greater than the total inference time.
+ *
+ * Entries can be correlated with the compiled model: ProfilingInfo::node_name matches the friendly name of the
+ * corresponding node in the runtime graph returned by ov::CompiledModel::get_runtime_model(), whose runtime
+ * information additionally carries the original (pre-fusion) layer names and a stable execution order
+ * (see openvino/runtime/exec_model_info.hpp). Both names and order are stable for the lifetime of a compiled
+ * model, so results of repeated ov::InferRequest::get_profiling_info() calls can be aggregated per node
+ * across inference requests without re-parsing the graph.
  */
 struct ProfilingInfo {
     /**
@@ -461,6 +461,25 @@ static constexpr Property<std::shared_ptr<ov::Model>> model{"MODEL_PTR"};
  */
 static constexpr Property<bool, PropertyMutability::RW> allow_auto_batching{"ALLOW_AUTO_BATCHING"};
 
+/**
+ * @brief Special key to share one CPU streams executor between all compiled models with the same
+ * stream configuration instead of creating a thread pool per model. Disabled by default.
+ * Keeps the total number of inference threads bounded when the number of loaded models
+ * exceeds the number of cores, at the cost of models competing for the shared streams.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_executor_sharing{"ENABLE_EXECUTOR_SHARING"};
+
+/**
+ * @brief Hint limiting the fraction of CPU time the inference streams may consume, in range (0.0, 1.0].
+ * The CPU streams executor enforces it with a token bucket on stream task dispatch: queued tasks are
+ * delayed once the streams run ahead of the requested share, so the runtime throttles itself smoothly
+ * between tasks rather than being descheduled mid-task by an external limiter. The default 1.0
+ * disables the throttling.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<double, PropertyMutability::RW> max_utilization{"MAX_UTILIZATION"};
+
 /**
  * @brief Enum to define possible execution mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -689,6 +708,21 @@ static constexpr Property<bool, PropertyMutability::RW> force_tbb_terminate{"FOR
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_mmap{"ENABLE_MMAP"};
 
+/**
+ * @brief Read-write property to key the model cache by the canonicalized model structure. Disabled by default.
+ *
+ * When enabled, the cache key is computed with the friendly names of internal operations and purely
+ * informational runtime attributes stripped, so programmatically generated models that differ only in
+ * naming and metadata share one cache entry. Input and output names stay part of the key: they are the
+ * interface of the restored compiled model.
+ *
+ * value type: boolean
+ *   - True compute the cache key from the canonicalized structure
+ *   - False compute the cache key from the model as given
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> cache_structural_key{"CACHE_STRUCTURAL_KEY"};
+
 /**
  * @brief Namespace with device properties
  */
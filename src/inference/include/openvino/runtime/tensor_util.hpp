@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides file-based helpers for ov::Tensor
+ *
+ * @file openvino/runtime/tensor_util.hpp
+ */
+#pragma once
+
+#include <string>
+
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+
+/**
+ * @brief Creates a read-only tensor on top of a memory mapped file region, without copying the data.
+ *
+ * The file is mapped lazily by the OS, so creating the tensor does not read it; pages are fetched
+ * on first access. The mapping is kept alive for the tensor lifetime and is released with the last
+ * tensor copy. The tensor data must not be written to: the mapping is read-only.
+ *
+ * @param file_name Path to the file with the tensor data
+ * @param element_type Element type of the resulting tensor. Types with a bitwidth of less than 8 bit
+ * are not supported
+ * @param shape Shape of the resulting tensor. The file must contain at least
+ * `offset_in_bytes + element_type.size() * shape_size(shape)` bytes
+ * @param offset_in_bytes Offset of the tensor data inside the file. Must be a multiple of the element
+ * size; offsets that are multiples of 64 are recommended, since some plugins expect cache-line
+ * aligned input data and fall back to a copy otherwise
+ * @return Tensor over the mapped file region
+ */
+OPENVINO_RUNTIME_API Tensor read_tensor_data(const std::string& file_name,
+                                             const element::Type& element_type,
+                                             const Shape& shape,
+                                             std::size_t offset_in_bytes = 0);
+
+/**
+ * @brief Creates a tensor backed by a named shared memory segment.
+ *
+ * The segment is created exclusively: a name that is already in use is an error. Another process
+ * opens the same data zero-copy with ov::open_shared_memory_tensor, so handing a tensor over
+ * costs one exchange of (name, element type, shape) instead of a data copy. The segment name
+ * stays registered with the OS for the lifetime of the returned tensor; processes that opened it
+ * before the creator released it keep a valid mapping afterwards. A portable name starts with '/'
+ * and contains no further slashes.
+ *
+ * @param name Name of the shared memory segment to create
+ * @param element_type Element type of the resulting tensor. Types with a bitwidth of less than 8 bit
+ * are not supported
+ * @param shape Shape of the resulting tensor; the segment is sized to exactly fit it
+ * @return Writable tensor over the freshly created segment
+ */
+OPENVINO_RUNTIME_API Tensor create_shared_memory_tensor(const std::string& name,
+                                                        const element::Type& element_type,
+                                                        const Shape& shape);
+
+/**
+ * @brief Opens a tensor over an existing named shared memory segment, without copying the data.
+ *
+ * The element type and shape are not stored in the segment and must match what the creating
+ * process passed to ov::create_shared_memory_tensor - they are part of the handle the processes
+ * exchange. The mapping is kept alive for the tensor lifetime and is released with the last
+ * tensor copy.
+ *
+ * @param name Name of the shared memory segment created by another process
+ * @param element_type Element type of the tensor stored in the segment
+ * @param shape Shape of the tensor stored in the segment. The segment must be large enough for it
+ * @return Writable tensor sharing the segment data
+ */
+OPENVINO_RUNTIME_API Tensor open_shared_memory_tensor(const std::string& name,
+                                                      const element::Type& element_type,
+                                                      const Shape& shape);
+
+}  // namespace ov
@@ -4,8 +4,20 @@
 
 #include "cache_guard.hpp"
 
+#include "file_utils.h"
 #include "ie_common.h"
 
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+#endif
+
 namespace ov {
 
 CacheGuardEntry::CacheGuardEntry(CacheGuard& cacheGuard,
@@ -21,6 +33,20 @@ CacheGuardEntry::CacheGuardEntry(CacheGuard& cacheGuard,
 }
 
 CacheGuardEntry::~CacheGuardEntry() {
+    // Release the cross-process lock before the in-process one, so that a thread waiting
+    // on the mutex starts with a fresh file lock acquisition
+#ifdef _WIN32
+    if (m_fileHandle != nullptr) {
+        OVERLAPPED overlapped = {};
+        ::UnlockFileEx(m_fileHandle, 0, 1, 0, &overlapped);
+        ::CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_lockFd != -1) {
+        ::flock(m_lockFd, LOCK_UN);
+        ::close(m_lockFd);
+    }
+#endif
     m_refCount--;
     m_mutex->unlock();
     m_cacheGuard.check_for_remove(m_hash);
@@ -30,9 +56,42 @@ void CacheGuardEntry::perform_lock() {
     m_mutex->lock();
 }
 
+void CacheGuardEntry::perform_file_lock(const std::string& cacheDir) {
+    // The lock file is deliberately left in the cache directory: removing it here would
+    // race with a peer process that has already opened it, so each cached blob keeps a
+    // tiny '<hash>.lock' companion instead
+    const auto lockFile = FileUtils::makePath(cacheDir, m_hash + ".lock");
+#ifdef _WIN32
+    HANDLE handle = ::CreateFileA(lockFile.c_str(),
+                                  GENERIC_READ | GENERIC_WRITE,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                  nullptr,
+                                  OPEN_ALWAYS,
+                                  FILE_ATTRIBUTE_NORMAL,
+                                  nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+        return;  // e.g. read-only cache directory - stay with in-process locking only
+    OVERLAPPED overlapped = {};
+    if (!::LockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped)) {
+        ::CloseHandle(handle);
+        return;
+    }
+    m_fileHandle = handle;
+#else
+    int fd = ::open(lockFile.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+    if (fd == -1)
+        return;  // e.g. read-only cache directory - stay with in-process locking only
+    if (::flock(fd, LOCK_EX) == -1) {
+        ::close(fd);
+        return;
+    }
+    m_lockFd = fd;
+#endif
+}
+
 //////////////////////////////////////////////////////
 
-std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& hash) {
+std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& hash, const std::string& cacheDir) {
     std::unique_lock<std::mutex> lock(m_tableMutex);
     auto& data = m_table[hash];
     std::unique_ptr<CacheGuardEntry> res;
@@ -49,6 +108,8 @@ std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& ha
     }
     lock.unlock();        // can unlock table lock here, as refCounter is positive and nobody can remove entry
     res->perform_lock();  // in case of exception, 'res' will be destroyed and item will be cleaned up from table
+    if (!cacheDir.empty())
+        res->perform_file_lock(cacheDir);
     return res;
 }
 
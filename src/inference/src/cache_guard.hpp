@@ -60,11 +60,28 @@ public:
      */
     void perform_lock();
 
+    /**
+     * @brief Additionally takes an exclusive OS-level lock on '<cacheDir>/<hash>.lock', so that
+     * processes sharing one cache directory also serialize work on the same cache entry
+     *
+     * Shall be called after perform_lock, i.e. when current process already owns the hash.
+     * If the lock file can not be created (e.g. read-only cache directory), locking silently
+     * stays in-process only. The lock is released on destruction
+     *
+     * @note Will be called only by CacheGuard, it shall not be called from client's code
+     */
+    void perform_file_lock(const std::string& cacheDir);
+
 private:
     CacheGuard& m_cacheGuard;
     std::string m_hash;
     std::shared_ptr<std::mutex> m_mutex;
     std::atomic_int& m_refCount;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+#else
+    int m_lockFd = -1;
+#endif
 };
 
 /**
@@ -87,12 +104,17 @@ public:
      * @brief Gets a lock for a specific cache entry identified by it's hash value
      * Once returned, client has an exclusive access to cache entry for read/write/delete
      * If any other thread holds a lock to same hash - this function will not return until it is unlocked
+     * When 'cacheDir' is provided, a file lock in that directory extends the exclusivity to other
+     * processes sharing the cache, so on a cold start exactly one of them compiles the model and
+     * the rest find the written blob once they acquire the lock
      *
      * @param hash String representing hash of network
+     * @param cacheDir Cache directory to place the cross-process lock file in; empty keeps
+     * locking in-process only
      *
      * @return RAII pointer to CacheGuardEntry
      */
-    std::unique_ptr<CacheGuardEntry> get_hash_lock(const std::string& hash);
+    std::unique_ptr<CacheGuardEntry> get_hash_lock(const std::string& hash, const std::string& cacheDir = {});
 
     /**
      * @brief Checks whether there is any clients holding the lock after CacheGuardEntry deletion
@@ -17,6 +17,7 @@
 #include "file_utils.h"
 #include "ie_itt.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "openvino/op/util/op_types.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -78,31 +79,51 @@ std::string ModelCache::calculate_file_info(const std::string& filePath) {
     return std::to_string(seed);
 }
 
-std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& model, const ov::AnyMap& compileOptions) {
+std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& model,
+                                     const ov::AnyMap& compileOptions,
+                                     bool structuralKey) {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "ModelCache::compute_hash - Model");
 
     OPENVINO_ASSERT(model);
 
+    auto hashedModel = std::const_pointer_cast<ov::Model>(model);
+    if (structuralKey) {
+        // Canonicalize a copy: the deterministic serialization run by the Hash pass omits
+        // auto-generated friendly names entirely, so resetting the names of internal operations
+        // makes renamed but isomorphic models hash identically. Parameters and Results keep
+        // their names - they are the interface of the compiled model restored from the blob.
+        hashedModel = model->clone();
+        hashedModel->set_friendly_name(hashedModel->get_name());
+        for (const auto& op : hashedModel->get_ordered_ops()) {
+            if (!ov::op::util::is_parameter(op) && !ov::op::util::is_output(op))
+                op->set_friendly_name(op->get_name());
+        }
+    }
+
     uint64_t seed = 0;
     // 1. Calculate hash on function
     ov::pass::Manager m;
     m.register_pass<ov::pass::FixRtInfo>();
     m.register_pass<ov::pass::Hash>(seed);
-    m.run_passes(std::const_pointer_cast<ov::Model>(model));
+    m.run_passes(hashedModel);
 
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
         seed = ov::hash_combine(seed, kvp.first + kvp.second.as<std::string>());
     }
 
-    // 3. Add runtime information which may not be serialized
-    for (const auto& op : model->get_ordered_ops()) {
-        const auto& rt = op->get_rt_info();
-        for (const auto& rtMapData : rt) {
-            seed = ov::hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = ov::hash_combine(seed, strm.str());
+    // 3. Add runtime information which may not be serialized. Skipped for the structural key:
+    // attributes such as fused names record original layer names and would leak them back
+    // into the hash
+    if (!structuralKey) {
+        for (const auto& op : model->get_ordered_ops()) {
+            const auto& rt = op->get_rt_info();
+            for (const auto& rtMapData : rt) {
+                seed = ov::hash_combine(seed, rtMapData.first);
+                std::stringstream strm;
+                rtMapData.second.print(strm);
+                seed = ov::hash_combine(seed, strm.str());
+            }
         }
     }
 
@@ -26,7 +26,20 @@ class Model;
 struct ModelCache final {
     static std::string calculate_file_info(const std::string& filePath);
 
-    static std::string compute_hash(const std::shared_ptr<const ov::Model>& model, const ov::AnyMap& compileOptions);
+    // The cache is keyed by a hash of the whole model plus the compilation options, so any
+    // model edit produces a new entry. Finer-grained keying (per subgraph/block) is not an
+    // option at this level: the cached artifact is the plugin's import_model blob, which is
+    // produced after cross-layer fusions, memory assignment and scheduling - kernels compiled
+    // for one partitioning are not valid in another, and no plugin exposes a per-subgraph
+    // export. Partial reuse would have to come from a device compiler's own kernel cache
+    // underneath, not from this blob cache.
+    // With structuralKey set, the hash is computed on a canonicalized copy of the model: friendly
+    // names of internal operations and purely informational runtime attributes are stripped, so
+    // structurally identical models produced under different names share one cache entry. Input and
+    // output names are kept - they are the interface of the compiled model restored from the blob.
+    static std::string compute_hash(const std::shared_ptr<const ov::Model>& model,
+                                    const ov::AnyMap& compileOptions,
+                                    bool structuralKey = false);
 
     static std::string compute_hash(const std::string& modelName, const ov::AnyMap& compileOptions);
     static std::string compute_hash(const std::string& modeStr,
@@ -4,6 +4,8 @@
 
 #include "openvino/runtime/compiled_model.hpp"
 
+#include <mutex>
+
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -20,13 +22,22 @@
 
 namespace ov {
 
+// Released requests recycled by acquire_infer_request(); shared between copies
+// of one CompiledModel object
+struct InferRequestPool {
+    std::mutex mutex;
+    std::vector<InferRequest> requests;
+};
+
 CompiledModel::~CompiledModel() {
+    _request_pool = {};
     _impl = {};
 }
 
 CompiledModel::CompiledModel(const std::shared_ptr<ov::ICompiledModel>& impl, const std::shared_ptr<void>& so)
     : _impl{impl},
-      _so{so} {
+      _so{so},
+      _request_pool{std::make_shared<InferRequestPool>()} {
     OPENVINO_ASSERT(_impl != nullptr, "CompiledModel was not initialized.");
 }
 
@@ -106,6 +117,58 @@ InferRequest CompiledModel::create_infer_request() {
     OV_COMPILED_MODEL_CALL_STATEMENT(return {_impl->create_infer_request(), _so});
 }
 
+InferRequest CompiledModel::acquire_infer_request() {
+    OV_COMPILED_MODEL_CALL_STATEMENT({
+        {
+            std::lock_guard<std::mutex> lock(_request_pool->mutex);
+            if (!_request_pool->requests.empty()) {
+                auto request = std::move(_request_pool->requests.back());
+                _request_pool->requests.pop_back();
+                return request;
+            }
+        }
+        return InferRequest{_impl->create_infer_request(), _so};
+    });
+}
+
+void CompiledModel::release_infer_request(InferRequest&& request) {
+    OPENVINO_ASSERT(_impl != nullptr, "CompiledModel was not initialized.");
+    OPENVINO_ASSERT(request, "Cannot release uninitialized InferRequest");
+    // A request that is still running must not be handed out to the next user
+    request.wait();
+    request.set_callback({});
+    std::lock_guard<std::mutex> lock(_request_pool->mutex);
+    _request_pool->requests.emplace_back(std::move(request));
+}
+
+void CompiledModel::infer_batch(std::vector<InferRequest>& requests) {
+    OPENVINO_ASSERT(_impl != nullptr, "CompiledModel was not initialized.");
+    // Requests report failures with typed exceptions (e.g. ov::Busy), so they are
+    // propagated as is instead of being rewrapped by OV_COMPILED_MODEL_CALL_STATEMENT
+    std::exception_ptr first_exception = nullptr;
+    size_t started = 0;
+    try {
+        for (; started < requests.size(); ++started) {
+            requests[started].start_async();
+        }
+    } catch (...) {
+        first_exception = std::current_exception();
+    }
+    // Wait for everything that was started even on failure to keep the requests idle
+    for (size_t i = 0; i < started; ++i) {
+        try {
+            requests[i].wait();
+        } catch (...) {
+            if (first_exception == nullptr) {
+                first_exception = std::current_exception();
+            }
+        }
+    }
+    if (first_exception) {
+        std::rethrow_exception(first_exception);
+    }
+}
+
 void CompiledModel::export_model(std::ostream& networkModel) {
     OV_COMPILED_MODEL_CALL_STATEMENT(_impl->export_model(networkModel));
 }
@@ -80,6 +80,11 @@ Core::Core(const std::string& xml_config_file) {
     OV_CORE_CALL_STATEMENT(_impl->register_compile_time_plugins();)
 }
 
+Core::Core(const std::string& xml_config_file, bool preload_plugins) : Core(xml_config_file) {
+    if (preload_plugins)
+        OV_CORE_CALL_STATEMENT(_impl->preload_plugins();)
+}
+
 std::map<std::string, Version> Core::get_versions(const std::string& device_name) const {
     OV_CORE_CALL_STATEMENT({
         std::map<std::string, Version> versions;
@@ -90,14 +95,19 @@ std::map<std::string, Version> Core::get_versions(const std::string& device_name
     })
 }
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-std::shared_ptr<ov::Model> Core::read_model(const std::wstring& model_path, const std::wstring& bin_path) const {
-    OV_CORE_CALL_STATEMENT(
-        return _impl->read_model(ov::util::wstring_to_string(model_path), ov::util::wstring_to_string(bin_path)););
+std::shared_ptr<ov::Model> Core::read_model(const std::wstring& model_path,
+                                            const std::wstring& bin_path,
+                                            const ov::AnyMap& properties) const {
+    OV_CORE_CALL_STATEMENT(return _impl->read_model(ov::util::wstring_to_string(model_path),
+                                                    ov::util::wstring_to_string(bin_path),
+                                                    properties););
 }
 #endif
 
-std::shared_ptr<ov::Model> Core::read_model(const std::string& model_path, const std::string& bin_path) const {
-    OV_CORE_CALL_STATEMENT(return _impl->read_model(model_path, bin_path););
+std::shared_ptr<ov::Model> Core::read_model(const std::string& model_path,
+                                            const std::string& bin_path,
+                                            const ov::AnyMap& properties) const {
+    OV_CORE_CALL_STATEMENT(return _impl->read_model(model_path, bin_path, properties););
 }
 
 std::shared_ptr<ov::Model> Core::read_model(const std::string& model, const ov::Tensor& weights) const {
@@ -4,7 +4,11 @@
 
 #include "core_impl.hpp"
 
+#include <iomanip>
+#include <iostream>
 #include <memory>
+#include <sstream>
+#include <thread>
 
 #include "any_copy.hpp"
 #include "check_network_batchable.hpp"
@@ -34,7 +38,9 @@
 #include "openvino/runtime/remote_context.hpp"
 #include "openvino/runtime/threading/executor_manager.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/env_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/memory_util.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "ov_plugins.hpp"
 #include "preprocessing/preprocessing.hpp"
@@ -45,6 +51,43 @@ ov::ICore::~ICore() = default;
 
 namespace {
 
+// Phase-level memory accounting, enabled with the OV_PROFILE_MEMORY_ENABLE environment
+// variable: reports how much the process resident set grew while a phase was running, which
+// attributes memory consumption to model reading, plugin compilation or cache import without
+// attaching an external heap profiler. When phases run concurrently for different models the
+// growth is attributed to whichever phase observes it, so treat the numbers as an estimate.
+class ScopedMemProfile {
+public:
+    static bool enabled() {
+        static const bool is_enabled = ov::util::getenv_bool("OV_PROFILE_MEMORY_ENABLE");
+        return is_enabled;
+    }
+
+    explicit ScopedMemProfile(const char* phase) : m_phase(phase) {
+        if (enabled())
+            m_start = ov::util::get_process_memory_usage();
+    }
+
+    ~ScopedMemProfile() {
+        if (!enabled())
+            return;
+        const auto to_mb = [](double bytes) {
+            return bytes / (1024.0 * 1024.0);
+        };
+        const auto current = ov::util::get_process_memory_usage();
+        const auto delta = current > m_start ? current - m_start : 0;
+        std::ostringstream report;
+        report << "MEMORY PROFILE: " << m_phase << ": +" << std::fixed << std::setprecision(1) << to_mb(delta)
+               << " MB (rss " << to_mb(current) << " MB, peak " << to_mb(ov::util::get_process_peak_memory_usage())
+               << " MB)";
+        std::cout << report.str() << std::endl;
+    }
+
+private:
+    const char* m_phase;
+    size_t m_start = 0;
+};
+
 template <typename F>
 void allowNotImplemented(F&& f) {
     try {
@@ -334,6 +377,34 @@ void ov::CoreImpl::register_compile_time_plugins() {
     }
 }
 
+void ov::CoreImpl::preload_plugins() {
+    std::vector<std::string> devices;
+    {
+        std::lock_guard<std::mutex> g_lock(get_mutex());
+        for (const auto& it : pluginRegistry) {
+            devices.push_back(it.first);
+        }
+    }
+
+    // get_plugin serializes per device (plus short global locks for the registry maps), so the
+    // shared libraries are opened and the devices enumerated concurrently here. A plugin which
+    // fails to load - e.g. the device is absent on this machine - is skipped; the error is
+    // reported on explicit use of the device, exactly as with lazy loading.
+    std::vector<std::thread> workers;
+    workers.reserve(devices.size());
+    for (const auto& device : devices) {
+        workers.emplace_back([this, device]() {
+            try {
+                get_plugin(device);
+            } catch (...) {
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
 void ov::CoreImpl::register_plugins_in_registry(const std::string& xml_config_file, const bool& by_abs_path) {
     std::lock_guard<std::mutex> lock(get_mutex());
 
@@ -540,6 +611,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::compile_model::model");
+    ScopedMemProfile memProfile("Core::compile_model::model");
     std::string deviceName = device_name;
     ov::AnyMap config_with_batch = config;
     // if auto-batching is applicable, the below function will patch the device name and config accordingly:
@@ -548,11 +620,14 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     auto parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch);
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> res;
-    auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
+    auto cacheConfig = coreConfig.get_cache_config_for_device(plugin, parsed._config);
+    auto cacheManager = cacheConfig._cacheManager;
     if (cacheManager && device_supports_model_caching(plugin)) {
         CacheContent cacheContent{cacheManager};
-        cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
-        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId);
+        cacheContent.blobId = ov::ModelCache::compute_hash(model,
+                                                           create_compile_config(plugin, parsed._config),
+                                                           coreConfig.get_structural_cache_key());
+        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId, cacheConfig._cacheDir);
         res = load_model_from_cache(cacheContent, plugin, parsed._config, ov::RemoteContext{}, [&]() {
             return compile_model_and_cache(model, plugin, parsed._config, ov::RemoteContext{}, cacheContent);
         });
@@ -566,6 +641,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
                                                           const ov::RemoteContext& context,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::compile_model::RemoteContext");
+    ScopedMemProfile memProfile("Core::compile_model::RemoteContext");
     if (context._impl == nullptr) {
         IE_THROW() << "Remote context is null";
     }
@@ -577,11 +653,14 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     auto parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch);
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> res;
-    auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
+    auto cacheConfig = coreConfig.get_cache_config_for_device(plugin, parsed._config);
+    auto cacheManager = cacheConfig._cacheManager;
     if (cacheManager && device_supports_model_caching(plugin)) {
         CacheContent cacheContent{cacheManager};
-        cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
-        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId);
+        cacheContent.blobId = ov::ModelCache::compute_hash(model,
+                                                           create_compile_config(plugin, parsed._config),
+                                                           coreConfig.get_structural_cache_key());
+        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId, cacheConfig._cacheDir);
         res = load_model_from_cache(cacheContent, plugin, parsed._config, context, [&]() {
             return compile_model_and_cache(model, plugin, parsed._config, context, cacheContent);
         });
@@ -614,16 +693,18 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ie::itt::domains::IE_LT, "Core::compile_model::Path");
+    ScopedMemProfile memProfile("Core::compile_model::Path");
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
     // in case of compile_model(file_name), we need to clear-up core-level properties
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> compiled_model;
 
-    auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
+    auto cacheConfig = coreConfig.get_cache_config_for_device(plugin, parsed._config);
+    auto cacheManager = cacheConfig._cacheManager;
     if (cacheManager && device_supports_model_caching(plugin)) {
         CacheContent cacheContent{cacheManager, model_path};
         cacheContent.blobId = ov::ModelCache::compute_hash(model_path, create_compile_config(plugin, parsed._config));
-        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId);
+        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId, cacheConfig._cacheDir);
         compiled_model = load_model_from_cache(cacheContent, plugin, parsed._config, ov::RemoteContext{}, [&]() {
             auto cnnNetwork = ReadNetwork(model_path, std::string());
             return compile_model_and_cache(cnnNetwork.getFunction(), plugin, parsed._config, {}, cacheContent);
@@ -645,17 +726,19 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "Core::compile_model::from_memory");
+    ScopedMemProfile memProfile("Core::compile_model::from_memory");
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
     // in case of compile_model(file_name), we need to clear-up core-level properties
     auto plugin = get_plugin(parsed._deviceName);
     ov::SoPtr<ov::ICompiledModel> compiled_model;
 
-    auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
+    auto cacheConfig = coreConfig.get_cache_config_for_device(plugin, parsed._config);
+    auto cacheManager = cacheConfig._cacheManager;
     if (cacheManager && device_supports_model_caching(plugin)) {
         CacheContent cacheContent{cacheManager};
         cacheContent.blobId =
             ov::ModelCache::compute_hash(model_str, weights, create_compile_config(plugin, parsed._config));
-        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId);
+        auto lock = cacheGuard.get_hash_lock(cacheContent.blobId, cacheConfig._cacheDir);
         compiled_model = load_model_from_cache(cacheContent, plugin, parsed._config, ov::RemoteContext{}, [&]() {
             auto cnnNetwork = read_model(model_str, weights);
             return compile_model_and_cache(cnnNetwork, plugin, parsed._config, ov::RemoteContext{}, cacheContent);
@@ -752,7 +835,9 @@ ov::AnyMap ov::CoreImpl::get_supported_property(const std::string& full_device_n
 
     static const std::vector<std::string> core_level_properties = {
         ov::cache_dir.name(),
+        ov::cache_structural_key.name(),
         ov::force_tbb_terminate.name(),
+        ov::hint::enable_executor_sharing.name(),
         // auto-batch properties are also treated as core-level
         ov::auto_batch_timeout.name(),
         ov::hint::allow_auto_batching.name(),
@@ -908,11 +993,17 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     if (name == ov::force_tbb_terminate.name()) {
         const auto flag = ov::threading::executor_manager()->get_property(name).as<bool>();
         return decltype(ov::force_tbb_terminate)::value_type(flag);
+    } else if (name == ov::hint::enable_executor_sharing.name()) {
+        const auto flag = ov::threading::executor_manager()->get_property(name).as<bool>();
+        return decltype(ov::hint::enable_executor_sharing)::value_type(flag);
     } else if (name == ov::cache_dir.name()) {
         return ov::Any(coreConfig.get_cache_dir());
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::cache_structural_key.name()) {
+        const auto flag = coreConfig.get_structural_cache_key();
+        return decltype(ov::cache_structural_key)::value_type(flag);
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1150,6 +1241,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(const std::s
                                                                     const ov::RemoteContext& context,
                                                                     const CacheContent& cacheContent) const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CoreImpl::compile_model_and_cache");
+    ScopedMemProfile memProfile("CoreImpl::compile_model_and_cache");
     ov::SoPtr<ov::ICompiledModel> execNetwork;
     execNetwork = compile_model_with_preprocess(plugin, model, context, parsedConfig);
     if (cacheContent.cacheManager && device_supports_model_caching(plugin)) {
@@ -1184,6 +1276,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
             OV_ITT_SCOPE(FIRST_INFERENCE,
                          InferenceEngine::itt::domains::IE_LT,
                          "Core::load_model_from_cache::ReadStreamAndImport");
+            ScopedMemProfile memProfile("Core::load_model_from_cache::ReadStreamAndImport");
             try {
                 ov::CompiledBlobHeader header;
                 networkStream >> header;
@@ -1293,12 +1386,26 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         config.erase(it);
     }
 
+    it = config.find(ov::hint::enable_executor_sharing.name());
+    if (it != config.end()) {
+        auto flag = it->second.as<bool>();
+        ov::threading::executor_manager()->set_property({{it->first, flag}});
+        config.erase(it);
+    }
+
     it = config.find(ov::enable_mmap.name());
     if (it != config.end()) {
         auto flag = it->second.as<bool>();
         _flag_enable_mmap = flag;
         config.erase(it);
     }
+
+    it = config.find(ov::cache_structural_key.name());
+    if (it != config.end()) {
+        auto flag = it->second.as<bool>();
+        _flag_structural_cache_key = flag;
+        config.erase(it);
+    }
 }
 
 void ov::CoreImpl::CoreConfig::set_cache_dir_for_device(const std::string& dir, const std::string& name) {
@@ -1315,6 +1422,10 @@ bool ov::CoreImpl::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
 
+bool ov::CoreImpl::CoreConfig::get_structural_cache_key() const {
+    return _flag_structural_cache_key;
+}
+
 // Creating thread-safe copy of config including shared_ptr to ICacheManager
 // Passing empty or not-existing name will return global cache config
 ov::CoreImpl::CoreConfig::CacheConfig ov::CoreImpl::CoreConfig::get_cache_config_for_device(
@@ -1368,9 +1479,23 @@ void ov::CoreImpl::add_mutex(const std::string& dev_name) {
 
 std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& modelPath, const std::string& binPath) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::read_model from file");
+    ScopedMemProfile memProfile("CoreImpl::read_model from file");
     return ReadNetwork(modelPath, binPath).getFunction();
 }
 
+std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& modelPath,
+                                                    const std::string& binPath,
+                                                    const ov::AnyMap& properties) const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::read_model from file");
+    ScopedMemProfile memProfile("CoreImpl::read_model from file");
+    auto enable_mmap = coreConfig.get_enable_mmap();
+    const auto it = properties.find(ov::enable_mmap.name());
+    if (it != properties.end())
+        enable_mmap = it->second.as<bool>();
+    return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, is_new_api(), enable_mmap)
+        .getFunction();
+}
+
 std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& model,
                                                     const ov::Tensor& weights,
                                                     bool frontendMode) const {
@@ -1379,5 +1504,6 @@ std::shared_ptr<ov::Model> ov::CoreImpl::read_model(const std::string& model,
         blob = tensor_to_blob(weights._impl);
     }
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::read_model from memory");
+    ScopedMemProfile memProfile("CoreImpl::read_model from memory");
     return ReadNetwork(model, blob, frontendMode).getFunction();
 }
@@ -86,6 +86,8 @@ private:
 
         bool get_enable_mmap() const;
 
+        bool get_structural_cache_key() const;
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig get_cache_config_for_device(const ov::Plugin& plugin, ov::AnyMap& parsedConfig) const;
@@ -95,6 +97,7 @@ private:
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
         bool _flag_enable_mmap = true;
+        bool _flag_structural_cache_key = false;
     };
 
     struct CacheContent {
@@ -227,6 +230,12 @@ public:
      */
     void register_compile_time_plugins();
 
+    /**
+     * @brief Eagerly loads all registered plugins in parallel.
+     * @note Plugins which fail to load are skipped; the error is reported on explicit use of the device
+     */
+    void preload_plugins();
+
     //
     // ICore public API
     //
@@ -362,6 +371,11 @@ public:
 
     std::shared_ptr<ov::Model> read_model(const std::string& model_path, const std::string& bin_path) const override;
 
+    // Reads a model from file allowing to override core-level read properties (e.g. ov::enable_mmap) per call
+    std::shared_ptr<ov::Model> read_model(const std::string& model_path,
+                                          const std::string& bin_path,
+                                          const ov::AnyMap& properties) const;
+
     ov::SoPtr<ov::ICompiledModel> compile_model(const std::shared_ptr<const ov::Model>& model,
                                                 const std::string& device_name,
                                                 const ov::AnyMap& config = {}) const override;
@@ -10,6 +10,7 @@
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/priority_task_executor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
 namespace {
@@ -23,6 +24,30 @@ struct ImmediateStreamsExecutor : public ov::threading::ITaskExecutor {
     std::shared_ptr<ov::threading::IStreamsExecutor> _streamsExecutor;
 };
 
+// Routes stage tasks into the lane matching the current priority of the request
+struct PriorityLaneExecutor : public ov::threading::ITaskExecutor {
+    PriorityLaneExecutor(const std::shared_ptr<ov::threading::PriorityTaskExecutor>& priorityExecutor,
+                         const ov::IAsyncInferRequest* request)
+        : _priorityExecutor{priorityExecutor},
+          _request{request} {}
+    void run(ov::threading::Task task) override {
+        _priorityExecutor->run(std::move(task), _request->get_priority());
+    }
+    std::shared_ptr<ov::threading::PriorityTaskExecutor> _priorityExecutor;
+    const ov::IAsyncInferRequest* _request;
+};
+
+// Index of the power-of-two microsecond bucket covering the given duration
+size_t latency_bucket(const std::chrono::steady_clock::duration& duration) {
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    size_t bucket = 0;
+    for (auto value = static_cast<uint64_t>(us > 0 ? us : 0); value > 1; value >>= 1)
+        ++bucket;
+    if (bucket >= ov::IAsyncInferRequest::LatencyStats::BUCKETS)
+        bucket = ov::IAsyncInferRequest::LatencyStats::BUCKETS - 1;
+    return bucket;
+}
+
 }  // namespace
 
 ov::IAsyncInferRequest::~IAsyncInferRequest() {
@@ -49,6 +74,23 @@ ov::IAsyncInferRequest::IAsyncInferRequest(const std::shared_ptr<IInferRequest>&
                                 m_sync_request->infer();
                             }}};
     }
+    auto priority_executor = std::dynamic_pointer_cast<ov::threading::PriorityTaskExecutor>(m_request_executor);
+    if (priority_executor != nullptr) {
+        for (auto&& stage : m_pipeline) {
+            if (stage.first == m_request_executor)
+                stage.first = std::make_shared<PriorityLaneExecutor>(priority_executor, this);
+        }
+    }
+}
+
+void ov::IAsyncInferRequest::set_priority(ov::hint::Priority priority) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_priority = priority;
+}
+
+ov::hint::Priority ov::IAsyncInferRequest::get_priority() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_priority;
 }
 
 void ov::IAsyncInferRequest::wait() {
@@ -120,7 +162,13 @@ void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginSta
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
+    m_submit_time = std::chrono::steady_clock::now();
+    firstStageExecutor->run(std::bind(
+        [this](ov::threading::Task& firstStageTask) {
+            record_queue_delay();
+            firstStageTask();
+        },
+        make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor))));
 }
 
 ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
@@ -147,6 +195,7 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
             }
 
             if ((itEndStage == itNextStage) || (nullptr != currentException)) {
+                record_duration();
                 auto lastStageTask = [this, currentException]() mutable {
                     auto promise = std::move(m_promise);
                     std::function<void(std::exception_ptr)> callback;
@@ -183,6 +232,27 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
         std::move(callbackExecutor));
 }
 
+void ov::IAsyncInferRequest::record_queue_delay() {
+    const auto bucket = latency_bucket(std::chrono::steady_clock::now() - m_submit_time);
+    m_queue_delay_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void ov::IAsyncInferRequest::record_duration() {
+    const auto bucket = latency_bucket(std::chrono::steady_clock::now() - m_submit_time);
+    m_duration_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_infer_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+ov::IAsyncInferRequest::LatencyStats ov::IAsyncInferRequest::get_latency_stats() const {
+    LatencyStats stats;
+    stats.count = m_infer_count.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < LatencyStats::BUCKETS; ++i) {
+        stats.durations[i] = m_duration_buckets[i].load(std::memory_order_relaxed);
+        stats.queue_delays[i] = m_queue_delay_buckets[i].load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
 void ov::IAsyncInferRequest::start_async() {
     infer_impl([&] {
         start_async_thread_unsafe();
@@ -4,9 +4,69 @@
 
 #include "openvino/runtime/iremote_context.hpp"
 
+#include <unordered_map>
+#include <vector>
+
 #include "dev/make_tensor.hpp"
+#include "openvino/core/except.hpp"
+
+namespace ov {
+
+// Free staging buffers of the context, bucketed by the size class
+struct StagingTensorPool {
+    std::mutex mutex;
+    std::unordered_map<size_t, std::vector<std::shared_ptr<ITensor>>> free_buffers;
+};
+
+namespace {
+
+constexpr size_t min_staging_class_size = 4096;
+
+size_t staging_size_class(size_t bytes) {
+    size_t size_class = min_staging_class_size;
+    while (size_class < bytes)
+        size_class <<= 1;
+    return size_class;
+}
+
+}  // namespace
+
+}  // namespace ov
 
 std::shared_ptr<ov::ITensor> ov::IRemoteContext::create_host_tensor(const ov::element::Type type,
                                                                     const ov::Shape& shape) {
     return ov::make_tensor(type, shape);
 }
+
+std::shared_ptr<ov::ITensor> ov::IRemoteContext::acquire_staging_tensor(const ov::element::Type& type,
+                                                                        const ov::Shape& shape) {
+    OPENVINO_ASSERT(type.bitwidth() >= 8,
+                    "Staging tensors for types with bitwidths less then 8 bit are not supported. Tensor type: ",
+                    type);
+    std::call_once(m_staging_pool_once, [&] {
+        m_staging_pool = std::make_shared<StagingTensorPool>();
+    });
+    const auto pool = m_staging_pool;
+    const size_t size_class = staging_size_class(type.size() * shape_size(shape));
+
+    std::shared_ptr<ITensor> storage;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto& bucket = pool->free_buffers[size_class];
+        if (!bucket.empty()) {
+            storage = std::move(bucket.back());
+            bucket.pop_back();
+        }
+    }
+    if (!storage) {
+        storage = create_host_tensor(element::u8, Shape{size_class});
+    }
+
+    // The returned tensor is a typed view over the pooled buffer; releasing the
+    // last reference recycles the buffer instead of freeing it
+    auto view = ov::make_tensor(type, shape, storage->data());
+    return std::shared_ptr<ITensor>(view.get(), [view, storage, pool, size_class](ITensor*) mutable {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->free_buffers[size_class].emplace_back(std::move(storage));
+    });
+}
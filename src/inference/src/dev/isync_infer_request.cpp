@@ -116,6 +116,17 @@ ov::ISyncInferRequest::FoundPort ov::ISyncInferRequest::find_port(const ov::Outp
                 node1->get_type_info() == node2->get_type_info() &&
                 node1->outputs().size() == node2->outputs().size() && node1->inputs().size() == node2->inputs().size());
     };
+    // The linear search below compares friendly names and name sets, which is measurable when
+    // set_tensor/get_tensor are called tens of thousands of times per second. Resolved ports are
+    // memoized by node identity: the compiled model's ports never change, so a port object that
+    // matched once always resolves to the same index.
+    const auto cache_key = std::make_pair(port.get_node(), port.get_index());
+    {
+        std::lock_guard<std::mutex> lock(m_cached_ports_mutex);
+        auto cached = m_cached_ports.find(cache_key);
+        if (cached != m_cached_ports.end())
+            return cached->second;
+    }
     ov::ISyncInferRequest::FoundPort::Type type = ov::ISyncInferRequest::FoundPort::Type::INPUT;
     for (const auto& ports : {get_inputs(), get_outputs()}) {
         for (size_t i = 0; i < ports.size(); i++) {
@@ -123,7 +134,10 @@ ov::ISyncInferRequest::FoundPort ov::ISyncInferRequest::find_port(const ov::Outp
             // if (ports[i] == port) {
             if (ports[i].get_index() == port.get_index() && ports[i].get_names() == port.get_names() &&
                 check_nodes(ports[i].get_node(), port.get_node())) {
-                return {i, type};
+                ov::ISyncInferRequest::FoundPort found_port{i, type};
+                std::lock_guard<std::mutex> lock(m_cached_ports_mutex);
+                m_cached_ports[cache_key] = found_port;
+                return found_port;
             }
         }
         type = ov::ISyncInferRequest::FoundPort::Type::OUTPUT;
@@ -165,12 +179,13 @@ void ov::ISyncInferRequest::convert_batched_tensors() {
         if (m_tensors.count(item.first))
             m_tensors[item.first] = item.second;
     }
+    m_tensors_validated = false;
 }
 
 ov::Tensor& ov::ISyncInferRequest::get_ref_tensor(const ov::Output<const ov::Node>& port) const {
     auto found_port = find_port(port);
     OPENVINO_ASSERT(found_port.found(), "Cannot find tensor for port ", port);
-    auto ports = found_port.is_input() ? get_inputs() : get_outputs();
+    const auto& ports = found_port.is_input() ? get_inputs() : get_outputs();
     auto it = m_tensors.find(ports.at(found_port.idx).get_tensor_ptr());
     OPENVINO_ASSERT(it != m_tensors.end(), "Cannot find tensor for port: ", port);
 
@@ -233,7 +248,7 @@ void ov::ISyncInferRequest::set_tensors_impl(const ov::Output<const ov::Node> po
 
 void ov::ISyncInferRequest::check_tensor(const ov::Output<const ov::Node>& port, const ov::Tensor& tensor) const {
     bool is_input = ov::op::util::is_parameter(port.get_node());
-    std::string tensor_type = is_input ? "input" : "output";
+    const char* tensor_type = is_input ? "input" : "output";
 
     OPENVINO_ASSERT(port.get_element_type() == tensor.get_element_type(),
                     "The tensor element type is not corresponding with output element type (",
@@ -258,9 +273,17 @@ void ov::ISyncInferRequest::allocate_tensor(const ov::Output<const ov::Node>& po
                                             const std::function<void(ov::Tensor& tensor)>& allocate_callback) {
     auto& tensor = get_ref_tensor(port);
     allocate_callback(tensor);
+    m_tensors_validated = false;
 }
 
 void ov::ISyncInferRequest::check_tensors() const {
+    // set_tensor runs the same per-port check on the way in, so a successful validation stays
+    // valid until a tensor arrives through a path that skips it (allocate_tensor callback,
+    // batched inputs). Eliding the re-check keeps per-infer overhead flat: element types of
+    // existing tensors cannot change, and ports with dynamic shapes are exempt from the shape
+    // check anyway.
+    if (m_tensors_validated)
+        return;
     const auto& inputs = m_compiled_model->inputs();
     for (size_t i = 0; i < inputs.size(); i++) {
         check_tensor(inputs[i], m_tensors.at(inputs[i].get_tensor_ptr()));
@@ -269,4 +292,5 @@ void ov::ISyncInferRequest::check_tensors() const {
     for (size_t i = 0; i < outputs.size(); i++) {
         check_tensor(outputs[i], m_tensors.at(outputs[i].get_tensor_ptr()));
     }
+    m_tensors_validated = true;
 }
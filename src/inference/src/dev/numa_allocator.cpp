@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/numa_allocator.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <tuple>
+
+#include "dev/threading/thread_affinity.hpp"
+#include "openvino/core/except.hpp"
+
+#if !(defined(__APPLE__) || defined(__EMSCRIPTEN__) || defined(_WIN32))
+#    include <sched.h>
+#endif
+
+namespace ov {
+
+namespace {
+
+#if !(defined(__APPLE__) || defined(__EMSCRIPTEN__) || defined(_WIN32))
+// Gets the affinity mask of the calling thread, unlike threading::get_process_mask()
+// which queries the whole process
+std::tuple<threading::CpuSet, int> get_thread_mask() {
+    for (int ncpus = sizeof(cpu_set_t) / CHAR_BIT; ncpus < 32768 /* reasonable limit of #cores*/; ncpus <<= 1) {
+        threading::CpuSet mask{CPU_ALLOC(ncpus)};
+        if (nullptr == mask)
+            break;
+        const size_t size = CPU_ALLOC_SIZE(ncpus);
+        CPU_ZERO_S(size, mask.get());
+        if (0 == sched_getaffinity(0, size, mask.get())) {
+            return std::make_tuple(std::move(mask), ncpus);
+        }
+        if (errno != EINVAL)
+            break;
+    }
+    return std::make_tuple(nullptr, 0);
+}
+#endif
+
+// First-touches the block so its pages are physically backed by the node the
+// touching thread runs on. For an explicit node the calling thread is temporary
+// moved there; its original affinity is restored afterwards.
+void first_touch(void* ptr, const size_t bytes, int numa_node_id) {
+#if !(defined(__APPLE__) || defined(__EMSCRIPTEN__) || defined(_WIN32))
+    if (numa_node_id >= 0) {
+        int ncpus = 0;
+        threading::CpuSet saved_mask;
+        std::tie(saved_mask, ncpus) = get_thread_mask();
+        if (saved_mask && threading::pin_current_thread_to_socket(numa_node_id)) {
+            std::memset(ptr, 0, bytes);
+            threading::pin_current_thread_by_mask(ncpus, saved_mask);
+            return;
+        }
+    }
+#endif
+    // No placement control on this platform or pinning failed: touch in-place,
+    // which is still the right thing for the "match calling thread" mode
+    std::memset(ptr, 0, bytes);
+}
+
+}  // namespace
+
+void* NumaNodeAllocator::allocate(const size_t bytes, const size_t alignment) {
+    void* handle = nullptr;
+    if (alignment == alignof(max_align_t)) {
+        handle = ::operator new(bytes);
+    } else {
+        OPENVINO_ASSERT(alignment && !static_cast<bool>(alignment & (alignment - static_cast<size_t>(1))),
+                        "Alignment is not power of 2: ",
+                        alignment);
+#if defined(_WIN32)
+        handle = _aligned_malloc(bytes, alignment);
+        OPENVINO_ASSERT(handle != nullptr, "_aligned_malloc failed");
+#else
+        if (posix_memalign(&handle, std::max(sizeof(void*), alignment), bytes) != 0) {
+            OPENVINO_THROW("posix_memalign failed");
+        }
+#endif
+    }
+    first_touch(handle, bytes, m_numa_node_id);
+    return handle;
+}
+
+void NumaNodeAllocator::deallocate(void* handle, const size_t bytes, const size_t alignment) {
+    if (alignment == alignof(max_align_t)) {
+        ::operator delete(handle);
+    } else {
+#if defined(_WIN32)
+        _aligned_free(handle);
+#else
+        free(handle);
+#endif
+    }
+}
+
+}  // namespace ov
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/property_store.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+
+size_t property_id(const std::string& name) {
+    static std::mutex ids_mutex;
+    static std::unordered_map<std::string, size_t> ids;
+    std::lock_guard<std::mutex> lock(ids_mutex);
+    return ids.emplace(name, ids.size()).first->second;
+}
+
+void PropertyStore::set(size_t id, Any value) {
+    if (m_values.size() <= id) {
+        m_values.resize(id + 1);
+    }
+    m_values[id] = std::move(value);
+}
+
+const Any& PropertyStore::get(size_t id) const {
+    OPENVINO_ASSERT(has(id), "Property with id ", id, " is not set");
+    return m_values[id];
+}
+
+bool PropertyStore::has(size_t id) const {
+    return id < m_values.size() && !m_values[id].empty();
+}
+
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -373,7 +374,14 @@ struct CPUStreamsExecutor::Impl {
                         }
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        if (_config._max_utilization < 1.0f) {
+                            WaitForBudget();
+                            const auto start = std::chrono::steady_clock::now();
+                            Execute(task, *(_streams.local()));
+                            ChargeBudget(std::chrono::steady_clock::now() - start);
+                        } else {
+                            Execute(task, *(_streams.local()));
+                        }
                     }
                 }
             });
@@ -417,6 +425,36 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    // Token bucket implementing ov::hint::max_utilization: the budget of execution time
+    // grows at the throttled rate and every finished task drains its duration, so the
+    // dispatch of queued tasks is delayed once the streams run ahead of the cap.
+    // Tasks are never interrupted, the budget just goes into debt and is paid off later.
+    void WaitForBudget() {
+        constexpr double burst_seconds = 0.1;  // budget accumulated at most while the streams are idle
+        std::unique_lock<std::mutex> throttleLock(_throttleMutex);
+        for (;;) {
+            const auto now = std::chrono::steady_clock::now();
+            const double rate = static_cast<double>(_config._max_utilization) * std::max(1, _config._streams);
+            _budget = std::min(_budget + std::chrono::duration<double>(now - _lastRefill).count() * rate,
+                               burst_seconds * rate);
+            _lastRefill = now;
+            if (_budget >= 0.0)
+                return;
+            const auto delay = std::chrono::duration<double>(-_budget / rate);
+            _throttleCondVar.wait_for(throttleLock, std::min(delay, std::chrono::duration<double>(burst_seconds)));
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_isStopped)
+                    return;
+            }
+        }
+    }
+
+    void ChargeBudget(const std::chrono::steady_clock::duration& elapsed) {
+        std::lock_guard<std::mutex> throttleLock(_throttleMutex);
+        _budget -= std::chrono::duration<double>(elapsed).count();
+    }
+
     Config _config;
     std::mutex _streamIdMutex;
     int _streamId = 0;
@@ -427,6 +465,10 @@ struct CPUStreamsExecutor::Impl {
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
+    std::mutex _throttleMutex;
+    std::condition_variable _throttleCondVar;
+    double _budget = 0.0;
+    std::chrono::steady_clock::time_point _lastRefill = std::chrono::steady_clock::now();
     std::vector<int> _usedNumaNodes;
     ov::threading::ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -460,6 +502,7 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
         _impl->_isStopped = true;
     }
     _impl->_queueCondVar.notify_all();
+    _impl->_throttleCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
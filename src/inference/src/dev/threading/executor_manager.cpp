@@ -44,6 +44,7 @@ private:
     mutable std::mutex streamExecutorMutex;
     mutable std::mutex taskExecutorMutex;
     bool tbbTerminateFlag = false;
+    bool executorSharingFlag = false;
     mutable std::mutex global_mutex;
     bool tbbThreadsCreated = false;
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
@@ -82,6 +83,8 @@ void ExecutorManagerImpl::set_property(const ov::AnyMap& properties) {
                 tbbTaskScheduler = nullptr;
             }
 #endif
+        } else if (it.first == ov::hint::enable_executor_sharing.name()) {
+            executorSharingFlag = it.second.as<bool>();
         }
     }
 }
@@ -89,6 +92,8 @@ ov::Any ExecutorManagerImpl::get_property(const std::string& name) const {
     std::lock_guard<std::mutex> guard(global_mutex);
     if (name == ov::force_tbb_terminate.name()) {
         return tbbTerminateFlag;
+    } else if (name == ov::hint::enable_executor_sharing.name()) {
+        return executorSharingFlag;
     }
     OPENVINO_THROW("Property ", name, " is not supported.");
 }
@@ -125,10 +130,16 @@ std::shared_ptr<ov::threading::ITaskExecutor> ExecutorManagerImpl::get_executor(
 
 std::shared_ptr<ov::threading::IStreamsExecutor> ExecutorManagerImpl::get_idle_cpu_streams_executor(
     const ov::threading::IStreamsExecutor::Config& config) {
+    const bool executor_sharing = [&] {
+        std::lock_guard<std::mutex> guard(global_mutex);
+        return executorSharingFlag;
+    }();
     std::lock_guard<std::mutex> guard(streamExecutorMutex);
     for (const auto& it : cpuStreamsExecutors) {
         const auto& executor = it.second;
-        if (executor.use_count() != 1)
+        // in the sharing mode compiled models with the same stream configuration reuse one
+        // executor (and so one thread pool) even while it's still held by other models
+        if (!executor_sharing && executor.use_count() != 1)
             continue;
 
         const auto& executorConfig = it.first;
@@ -206,6 +206,22 @@ void IStreamsExecutor::Config::set_property(const ov::AnyMap& property) {
                            << ". Expected only non negative numbers";
             }
             _small_core_offset = val_i;
+        } else if (key == ov::hint::max_utilization) {
+            double val_d;
+            try {
+                val_d = value.as<double>();
+            } catch (const std::exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::hint::max_utilization.name(),
+                               ". Expected a number in the (0.0, 1.0] range");
+            }
+            if (val_d <= 0.0 || val_d > 1.0) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::hint::max_utilization.name(),
+                               ". Expected a number in the (0.0, 1.0] range, got: ",
+                               val_d);
+            }
+            _max_utilization = static_cast<float>(val_d);
         } else if (key == CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD)) {
             if (value.as<std::string>() == CONFIG_VALUE(YES)) {
                 _enable_hyper_thread = true;
@@ -236,6 +252,7 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
             ov::num_streams.name(),
             ov::inference_num_threads.name(),
             ov::affinity.name(),
+            ov::hint::max_utilization.name(),
         };
         return properties;
     } else if (key == ov::affinity) {
@@ -268,6 +285,8 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
         return {std::to_string(_threads)};
     } else if (key == ov::inference_num_threads) {
         return decltype(ov::inference_num_threads)::value_type{_threads};
+    } else if (key == ov::hint::max_utilization) {
+        return decltype(ov::hint::max_utilization)::value_type{_max_utilization};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
     } else if (key == CONFIG_KEY_INTERNAL(BIG_CORE_STREAMS)) {
@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/threading/priority_task_executor.hpp"
+
+#include <array>
+#include <deque>
+#include <mutex>
+
+namespace ov {
+namespace threading {
+
+struct PriorityTaskExecutor::Impl : public std::enable_shared_from_this<PriorityTaskExecutor::Impl> {
+    explicit Impl(std::shared_ptr<ITaskExecutor> executor) : _executor{std::move(executor)} {}
+
+    void enqueue(Task task, ov::hint::Priority priority) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _lanes[lane_of(priority)].emplace_back(std::move(task));
+        }
+        // The underlying executor gets one generic drain task per enqueued task;
+        // each drain pops the most urgent pending task, not necessarily the one
+        // that scheduled it, which is how high priority tasks overtake the queue.
+        auto self = shared_from_this();
+        _executor->run([self] {
+            Task task;
+            {
+                std::lock_guard<std::mutex> lock(self->_mutex);
+                for (auto lane = self->_lanes.rbegin(); lane != self->_lanes.rend(); ++lane) {
+                    if (!lane->empty()) {
+                        task = std::move(lane->front());
+                        lane->pop_front();
+                        break;
+                    }
+                }
+            }
+            if (task)
+                task();
+        });
+    }
+
+    static size_t lane_of(ov::hint::Priority priority) {
+        const auto lane = static_cast<size_t>(priority);
+        return lane < num_lanes ? lane : num_lanes - 1;
+    }
+
+    static constexpr size_t num_lanes = static_cast<size_t>(ov::hint::Priority::HIGH) + 1;
+
+    std::shared_ptr<ITaskExecutor> _executor;
+    std::mutex _mutex;
+    std::array<std::deque<Task>, num_lanes> _lanes;
+};
+
+PriorityTaskExecutor::PriorityTaskExecutor(std::shared_ptr<ITaskExecutor> executor)
+    : _impl{std::make_shared<Impl>(std::move(executor))} {}
+
+PriorityTaskExecutor::~PriorityTaskExecutor() = default;
+
+void PriorityTaskExecutor::run(Task task) {
+    run(std::move(task), ov::hint::Priority::DEFAULT);
+}
+
+void PriorityTaskExecutor::run(Task task, ov::hint::Priority priority) {
+    if (!task)
+        return;
+    _impl->enqueue(std::move(task), priority);
+}
+
+}  // namespace threading
+}  // namespace ov
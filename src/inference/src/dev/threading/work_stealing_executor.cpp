@@ -0,0 +1,129 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/threading/work_stealing_executor.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "openvino/itt.hpp"
+
+namespace ov {
+namespace threading {
+
+struct WorkStealingExecutor::Impl {
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    explicit Impl(const std::string& name, int threads) : _name{name} {
+        const auto num_workers =
+            threads > 0 ? static_cast<size_t>(threads) : std::max<size_t>(1, std::thread::hardware_concurrency());
+        _queues.resize(num_workers);
+        for (auto& queue : _queues)
+            queue.reset(new WorkerQueue{});
+        _workers.reserve(num_workers);
+        for (size_t worker_id = 0; worker_id < num_workers; ++worker_id) {
+            _workers.emplace_back([this, worker_id] {
+                worker_loop(worker_id);
+            });
+        }
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(_wait_mutex);
+            _stopped = true;
+        }
+        _wait_cv.notify_all();
+        for (auto& worker : _workers)
+            worker.join();
+    }
+
+    void enqueue(Task task) {
+        const size_t queue_id = _next_queue++ % _queues.size();
+        {
+            std::lock_guard<std::mutex> lock(_queues[queue_id]->mutex);
+            _queues[queue_id]->tasks.emplace_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(_wait_mutex);
+            ++_pending;
+        }
+        _wait_cv.notify_one();
+    }
+
+    Task try_pop(size_t worker_id) {
+        // Own queue is popped LIFO for cache locality, steals take the oldest
+        // task of a sibling so large backlogs are drained from the producer end
+        {
+            auto& own = *_queues[worker_id];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                auto task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return task;
+            }
+        }
+        for (size_t i = 1; i < _queues.size(); ++i) {
+            auto& victim = *_queues[(worker_id + i) % _queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                auto task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return task;
+            }
+        }
+        return {};
+    }
+
+    void worker_loop(size_t worker_id) {
+        openvino::itt::threadName(_name + "_" + std::to_string(worker_id));
+        while (true) {
+            auto task = try_pop(worker_id);
+            if (!task) {
+                std::unique_lock<std::mutex> lock(_wait_mutex);
+                _wait_cv.wait(lock, [this] {
+                    return _stopped || _pending > 0;
+                });
+                if (_stopped && _pending == 0)
+                    return;
+                continue;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_wait_mutex);
+                --_pending;
+            }
+            task();
+        }
+    }
+
+    std::string _name;
+    std::vector<std::unique_ptr<WorkerQueue>> _queues;
+    std::vector<std::thread> _workers;
+    std::mutex _wait_mutex;
+    std::condition_variable _wait_cv;
+    size_t _pending = 0;
+    bool _stopped = false;
+    std::atomic<size_t> _next_queue{0};
+};
+
+WorkStealingExecutor::WorkStealingExecutor(const std::string& name, int threads)
+    : _impl{new Impl{name, threads}} {}
+
+WorkStealingExecutor::~WorkStealingExecutor() = default;
+
+void WorkStealingExecutor::run(Task task) {
+    if (!task)
+        return;
+    _impl->enqueue(std::move(task));
+}
+
+}  // namespace threading
+}  // namespace ov
@@ -17,6 +17,11 @@
 #include "file_utils.h"
 #include "ie_api.h"
 
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
 namespace ov {
 
 /**
@@ -107,6 +112,16 @@ private:
     void read_cache_entry(const std::string& id, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
+#if defined(__linux__)
+            // Ask the kernel to start fetching the whole blob right away: import reads it
+            // sequentially, so on a cold page cache the readahead overlaps disk I/O with
+            // the deserialization work instead of blocking on every chunk
+            int fd = ::open(blobFileName.c_str(), O_RDONLY);
+            if (fd != -1) {
+                ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+                ::close(fd);
+            }
+#endif
             std::ifstream stream(blobFileName, std::ios_base::binary);
             reader(stream);
         }
@@ -0,0 +1,398 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/tensor_util.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/shape.hpp"
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+
+namespace {
+
+#if defined(_WIN32)
+
+class MapHolder {
+public:
+    MapHolder() = default;
+
+    ~MapHolder() {
+        if (m_data) {
+            ::UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(m_mapping);
+        }
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(m_handle);
+        }
+    }
+
+    void set(const std::string& path) {
+        // Note that file can't be changed (renamed/deleted) until it's unmapped. FILE_SHARE_DELETE flag allow
+        // rename/deletion, but it doesn't work with FAT32 filesystem (works on NTFS)
+        m_handle = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+        OPENVINO_ASSERT(m_handle != INVALID_HANDLE_VALUE,
+                        "Can not open file ",
+                        path,
+                        " for mapping. Ensure that file exists and has appropriate permissions");
+
+        LARGE_INTEGER file_size_large;
+        OPENVINO_ASSERT(::GetFileSizeEx(m_handle, &file_size_large) != 0, "Can not get file size for ", path);
+
+        m_size = static_cast<uint64_t>(file_size_large.QuadPart);
+        if (m_size > 0) {
+            m_mapping = ::CreateFileMapping(m_handle, 0, PAGE_READONLY, m_size >> 32, m_size & 0xffffffff, 0);
+            OPENVINO_ASSERT(m_mapping != INVALID_HANDLE_VALUE, "Can not create file mapping for ", path);
+
+            m_data = ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, m_size);
+            OPENVINO_ASSERT(m_data, "Can not create map view for ", path);
+        }
+    }
+
+    char* data() noexcept {
+        return static_cast<char*>(m_data);
+    }
+    size_t size() const noexcept {
+        return m_size;
+    }
+
+private:
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = INVALID_HANDLE_VALUE;
+};
+
+#else
+
+class MapHolder {
+public:
+    MapHolder() = default;
+
+    ~MapHolder() {
+        if (m_data != MAP_FAILED) {
+            munmap(m_data, m_size);
+        }
+        if (m_handle != -1) {
+            close(m_handle);
+        }
+    }
+
+    void set(const std::string& path) {
+        struct stat sb = {};
+        m_handle = open(path.c_str(), O_RDONLY);
+        OPENVINO_ASSERT(m_handle != -1,
+                        "Can not open file ",
+                        path,
+                        " for mapping. Ensure that file exists and has appropriate permissions");
+        OPENVINO_ASSERT(fstat(m_handle, &sb) != -1, "Can not get file size for ", path);
+        m_size = sb.st_size;
+        if (m_size > 0) {
+            m_data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_handle, 0);
+            OPENVINO_ASSERT(m_data != MAP_FAILED, "Can not create file mapping for ", path, ", err=", strerror(errno));
+        }
+    }
+
+    char* data() noexcept {
+        return static_cast<char*>(m_data);
+    }
+    size_t size() const noexcept {
+        return m_size;
+    }
+
+private:
+    void* m_data = MAP_FAILED;
+    size_t m_size = 0;
+    int m_handle = -1;
+};
+
+#endif
+
+#if defined(_WIN32)
+
+class SharedMemoryHolder {
+public:
+    SharedMemoryHolder() = default;
+
+    ~SharedMemoryHolder() {
+        if (m_data) {
+            ::UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(m_mapping);
+        }
+        // The segment name stays valid until the last handle to the mapping is closed,
+        // so there is nothing to unlink explicitly
+    }
+
+    void create(const std::string& name, size_t size) {
+        m_mapping = ::CreateFileMappingA(INVALID_HANDLE_VALUE,
+                                         0,
+                                         PAGE_READWRITE,
+                                         static_cast<DWORD>(size >> 32),
+                                         static_cast<DWORD>(size & 0xffffffff),
+                                         name.c_str());
+        OPENVINO_ASSERT(m_mapping != NULL && m_mapping != INVALID_HANDLE_VALUE,
+                        "Can not create shared memory segment ",
+                        name);
+        if (::GetLastError() == ERROR_ALREADY_EXISTS) {
+            ::CloseHandle(m_mapping);
+            m_mapping = INVALID_HANDLE_VALUE;
+            OPENVINO_THROW("Shared memory segment ", name, " already exists");
+        }
+        map(name, size);
+    }
+
+    void open(const std::string& name, size_t size) {
+        m_mapping = ::OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+        OPENVINO_ASSERT(m_mapping != NULL,
+                        "Can not open shared memory segment ",
+                        name,
+                        ". Ensure that the creating process still holds its tensor");
+        map(name, size);
+    }
+
+    char* data() noexcept {
+        return static_cast<char*>(m_data);
+    }
+    size_t size() const noexcept {
+        return m_size;
+    }
+
+private:
+    void map(const std::string& name, size_t size) {
+        m_data = ::MapViewOfFile(m_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+        OPENVINO_ASSERT(m_data, "Can not map shared memory segment ", name);
+        m_size = size;
+    }
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    HANDLE m_mapping = INVALID_HANDLE_VALUE;
+};
+
+#elif defined(__ANDROID__)
+
+class SharedMemoryHolder {
+public:
+    // Bionic provides no shm_open; ashmem would need a different transport
+    void create(const std::string&, size_t) {
+        OPENVINO_THROW("Shared memory tensors are not supported on this platform");
+    }
+    void open(const std::string&, size_t) {
+        OPENVINO_THROW("Shared memory tensors are not supported on this platform");
+    }
+    char* data() noexcept {
+        return nullptr;
+    }
+    size_t size() const noexcept {
+        return 0;
+    }
+};
+
+#else
+
+class SharedMemoryHolder {
+public:
+    SharedMemoryHolder() = default;
+
+    ~SharedMemoryHolder() {
+        if (m_data != MAP_FAILED) {
+            munmap(m_data, m_size);
+        }
+        if (m_handle != -1) {
+            close(m_handle);
+        }
+        // Unregister the name with the creator; processes that opened the segment before
+        // keep their mappings valid, the memory goes away with the last of them
+        if (m_owner) {
+            shm_unlink(m_name.c_str());
+        }
+    }
+
+    void create(const std::string& name, size_t size) {
+        m_handle = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        OPENVINO_ASSERT(m_handle != -1,
+                        "Can not create shared memory segment ",
+                        name,
+                        ", err=",
+                        strerror(errno));
+        m_name = name;
+        m_owner = true;
+        OPENVINO_ASSERT(ftruncate(m_handle, size) != -1,
+                        "Can not resize shared memory segment ",
+                        name,
+                        " to ",
+                        size,
+                        " bytes, err=",
+                        strerror(errno));
+        map(name, size);
+    }
+
+    void open(const std::string& name, size_t size) {
+        m_handle = shm_open(name.c_str(), O_RDWR, 0);
+        OPENVINO_ASSERT(m_handle != -1,
+                        "Can not open shared memory segment ",
+                        name,
+                        ". Ensure that the creating process still holds its tensor, err=",
+                        strerror(errno));
+        struct stat sb = {};
+        OPENVINO_ASSERT(fstat(m_handle, &sb) != -1, "Can not get size of shared memory segment ", name);
+        OPENVINO_ASSERT(static_cast<size_t>(sb.st_size) >= size,
+                        "Shared memory segment ",
+                        name,
+                        " of ",
+                        sb.st_size,
+                        " bytes is smaller than the requested tensor data of ",
+                        size,
+                        " bytes");
+        map(name, size);
+    }
+
+    char* data() noexcept {
+        return static_cast<char*>(m_data);
+    }
+    size_t size() const noexcept {
+        return m_size;
+    }
+
+private:
+    void map(const std::string& name, size_t size) {
+        m_data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_handle, 0);
+        OPENVINO_ASSERT(m_data != MAP_FAILED,
+                        "Can not map shared memory segment ",
+                        name,
+                        ", err=",
+                        strerror(errno));
+        m_size = size;
+    }
+
+    void* m_data = MAP_FAILED;
+    size_t m_size = 0;
+    int m_handle = -1;
+    bool m_owner = false;
+    std::string m_name;
+};
+
+#endif
+
+// "Allocator" handing out a region of the mapped file; keeps the mapping alive
+// as long as the tensor created on top of it exists
+struct MappedMemoryAllocator {
+    std::shared_ptr<MapHolder> map;
+    size_t offset;
+
+    void* allocate(const size_t bytes, const size_t) {
+        OPENVINO_ASSERT(offset + bytes <= map->size(), "Mapped file region is smaller than the requested tensor data");
+        return map->data() + offset;
+    }
+    void deallocate(void*, const size_t, const size_t) {}
+    bool is_equal(const MappedMemoryAllocator& other) const {
+        return map == other.map && offset == other.offset;
+    }
+};
+
+// Same idea for shared memory segments: the segment lives as long as the tensor
+struct SharedMemoryAllocator {
+    std::shared_ptr<SharedMemoryHolder> segment;
+
+    void* allocate(const size_t bytes, const size_t) {
+        OPENVINO_ASSERT(bytes <= segment->size(), "Shared memory segment is smaller than the requested tensor data");
+        return segment->data();
+    }
+    void deallocate(void*, const size_t, const size_t) {}
+    bool is_equal(const SharedMemoryAllocator& other) const {
+        return segment == other.segment;
+    }
+};
+
+size_t checked_byte_size(const char* func_name, const element::Type& element_type, const Shape& shape) {
+    OPENVINO_ASSERT(element_type != element::undefined && element_type.is_static(),
+                    func_name,
+                    " does not support ",
+                    element_type,
+                    " element type");
+    OPENVINO_ASSERT(element_type.bitwidth() >= 8,
+                    func_name,
+                    " does not support types with bitwidths less then 8 bit. Tensor type: ",
+                    element_type);
+    const size_t byte_size = element_type.size() * shape_size(shape);
+    OPENVINO_ASSERT(byte_size > 0, func_name, " does not support empty tensors");
+    return byte_size;
+}
+
+}  // namespace
+
+Tensor read_tensor_data(const std::string& file_name,
+                        const element::Type& element_type,
+                        const Shape& shape,
+                        std::size_t offset_in_bytes) {
+    OPENVINO_ASSERT(element_type != element::undefined && element_type.is_static(),
+                    "read_tensor_data does not support ",
+                    element_type,
+                    " element type");
+    OPENVINO_ASSERT(element_type.bitwidth() >= 8,
+                    "read_tensor_data does not support types with bitwidths less then 8 bit. Tensor type: ",
+                    element_type);
+    OPENVINO_ASSERT(offset_in_bytes % element_type.size() == 0,
+                    "Tensor data offset ",
+                    offset_in_bytes,
+                    " is not a multiple of the element size of ",
+                    element_type);
+
+    auto map = std::make_shared<MapHolder>();
+    map->set(file_name);
+
+    const size_t byte_size = element_type.size() * shape_size(shape);
+    OPENVINO_ASSERT(offset_in_bytes + byte_size <= map->size(),
+                    "File ",
+                    file_name,
+                    " of ",
+                    map->size(),
+                    " bytes is too small for a ",
+                    element_type,
+                    " tensor of shape ",
+                    shape,
+                    " at offset ",
+                    offset_in_bytes);
+
+    return {element_type, shape, Allocator{MappedMemoryAllocator{std::move(map), offset_in_bytes}}};
+}
+
+Tensor create_shared_memory_tensor(const std::string& name, const element::Type& element_type, const Shape& shape) {
+    const size_t byte_size = checked_byte_size("create_shared_memory_tensor", element_type, shape);
+
+    auto segment = std::make_shared<SharedMemoryHolder>();
+    segment->create(name, byte_size);
+
+    return {element_type, shape, Allocator{SharedMemoryAllocator{std::move(segment)}}};
+}
+
+Tensor open_shared_memory_tensor(const std::string& name, const element::Type& element_type, const Shape& shape) {
+    const size_t byte_size = checked_byte_size("open_shared_memory_tensor", element_type, shape);
+
+    auto segment = std::make_shared<SharedMemoryHolder>();
+    segment->open(name, byte_size);
+
+    return {element_type, shape, Allocator{SharedMemoryAllocator{std::move(segment)}}};
+}
+
+}  // namespace ov
@@ -173,6 +173,20 @@ void AutoSchedule::GenerateWorkers(const std::string& device,
             [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                if (_pCTPUTLoadContext) {
+                    // account the finished request into the device average and drop its in-flight
+                    // depth, so the next scheduling decision sees the up-to-date device load
+                    auto statsIter = _workerExecStats.find(device);
+                    if (statsIter != _workerExecStats.end()) {
+                        const uint64_t execTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+                        auto& stats = statsIter->second;
+                        const uint64_t avg = stats._avgExecTimeUs.load(std::memory_order_relaxed);
+                        stats._avgExecTimeUs.store(avg == 0 ? execTimeUs : (avg * 7 + execTimeUs) / 8,
+                            std::memory_order_relaxed);
+                        stats._inflightNums--;
+                    }
+                }
                 {
                     auto stopRetryAndContinue = [workerRequestPtr]() {
                         auto capturedTask = std::move(workerRequestPtr->_task);
@@ -387,6 +401,19 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
             contextPtr->isReloadSuccess = true;
             auto& deviceName = contextPtr->deviceInfo.deviceName;
             LOG_INFO_TAG("device:%s loading Network finished", deviceName.c_str());
+            // all just generated workers of this device are idle: pull the backlog accumulated
+            // while it was loading, otherwise the queued tasks would start here only when one of
+            // the helper device requests completes and re-schedules them from its callback
+            IE::Task t;
+            do {
+                _inferPipelineTasks.try_pop(t);
+            } while (t && ScheduleToWorkerInferRequest(std::move(t)));
+            auto deviceSpecificTasks = _inferPipelineTasksDeviceSpecific.find(contextPtr->workName);
+            if (deviceSpecificTasks != _inferPipelineTasksDeviceSpecific.end() && deviceSpecificTasks->second) {
+                do {
+                    deviceSpecificTasks->second->try_pop(t);
+                } while (t && ScheduleToWorkerInferRequest(std::move(t), contextPtr->workName));
+            }
             auto supported_config_keys = _autoSContext->_core->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS))
                                              .as<std::vector<std::string>>();
             DEBUG_RUN([this, &contextPtr, &deviceName, &supported_config_keys] {
@@ -573,6 +600,7 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
                 // initialize containers before run async task, if not initialized, it will hang during infer
                 _idleWorkerRequests[device.deviceName];
                 _workerRequests[device.deviceName];
+                _workerExecStats[device.deviceName];
                 _inferPipelineTasksDeviceSpecific[device.deviceName] = nullptr;
             }
             _executor = _autoSContext->_plugin->executorManager()->getIdleCPUStreamsExecutor(IStreamsExecutor::Config{
@@ -780,6 +808,14 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
     } else {
         if (_pCTPUTLoadContext) {
             devices = _autoSContext->_devicePriorities;
+            // order the candidates by the predicted completion time instead of the static
+            // priority, so each request lands on the device expected to finish it first given
+            // its current backlog. Devices without measurements yet predict zero and keep their
+            // priority order, which lets every device collect its first samples
+            std::stable_sort(devices.begin(), devices.end(),
+                [this](const DeviceInformation& a, const DeviceInformation& b) {
+                    return PredictCompletionTime(a.deviceName) < PredictCompletionTime(b.deviceName);
+                });
         } else {
             // _acceleratorDevice could be the same as _cpuDevice, such as AUTO:CPU
             if (_loadContext[FALLBACKDEVICE].isAlready) {
@@ -803,6 +839,12 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
             continue;
         }
         if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+            if (_pCTPUTLoadContext) {
+                auto statsIter = _workerExecStats.find(device.deviceName);
+                if (statsIter != _workerExecStats.end()) {
+                    statsIter->second._inflightNums++;
+                }
+            }
             return true;
         }
     }
@@ -815,6 +857,18 @@ bool AutoSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Devi
     return false;
 }
 
+uint64_t AutoSchedule::PredictCompletionTime(const DeviceName& device) const {
+    auto statsIter = _workerExecStats.find(device);
+    if (statsIter == _workerExecStats.end()) {
+        return 0;
+    }
+    const auto& stats = statsIter->second;
+    // the in-flight counter is updated without synchronization with the worker callbacks,
+    // so it may transiently go below zero - treat such readings as an empty backlog
+    const auto inflightNums = std::max(stats._inflightNums.load(std::memory_order_relaxed), 0);
+    return stats._avgExecTimeUs.load(std::memory_order_relaxed) * (inflightNums + 1);
+}
+
 bool AutoSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     NotBusyPriorityWorkerRequests& idleWorkerRequests,
     const DeviceName& preferred_device) {
@@ -822,6 +876,7 @@ bool AutoSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     std::pair<int, WorkerInferRequest*> worker;
     if (idleWorkerRequests.try_pop(worker)) {
         workerRequestPtr = worker.second;
+        workerRequestPtr->_startTime = std::chrono::steady_clock::now();
         IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{workerRequestPtr, idleWorkerRequests};
         _thisWorkerInferRequest = workerRequestPtr;
         {
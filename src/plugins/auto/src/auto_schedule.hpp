@@ -74,12 +74,21 @@ public:
     size_t                                    _nCTputDeviceNums = 0;
 
 protected:
+    // feedback for the cumulative throughput schedule: approximate number of requests
+    // currently running on the device and an exponential moving average of the request
+    // duration, updated from the worker callbacks without locking
+    struct WorkerExecStats {
+        std::atomic<int>      _inflightNums{0};
+        std::atomic<uint64_t> _avgExecTimeUs{0};
+    };
     void GenerateWorkers(const std::string& device, const SoExecNetwork& executableNetwork);
     bool ScheduleToWorkerInferRequest(IE::Task, DeviceName preferred_device = "");
     static bool RunPipelineTask(IE::Task& inferPipelineTask, NotBusyPriorityWorkerRequests& idleWorkerRequests,
                                 const DeviceName& preferred_device);
+    uint64_t PredictCompletionTime(const DeviceName& device) const;
     std::string GetLogTag() const noexcept;
     DeviceMap<NotBusyPriorityWorkerRequests>                _idleWorkerRequests;
+    DeviceMap<WorkerExecStats>                              _workerExecStats;
     AutoScheduleContext::Ptr                                _autoSContext;
     std::atomic_size_t                                      _numRequestsCreated = {0};
     DeviceMap<std::vector<WorkerInferRequest>>              _workerRequests;
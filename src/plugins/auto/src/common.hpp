@@ -82,6 +82,7 @@ struct WorkerInferRequest {
     std::exception_ptr _exceptionPtr = nullptr;
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
+    Time               _startTime;
     int                _index = 0;
     MultiImmediateExecutor::Ptr  _fallbackExec;
 };
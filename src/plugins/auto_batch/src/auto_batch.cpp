@@ -389,6 +389,7 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            workerInferRequest.RegisterArrival();
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest._tasks.size());
@@ -469,6 +470,64 @@ std::shared_ptr<InferenceEngine::RemoteContext> AutoBatchExecutableNetwork::GetC
     return _networkWithoutBatch->GetContext();
 }
 
+static uint64_t SteadyClockNowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void AutoBatchExecutableNetwork::WorkerInferRequest::RegisterArrival() {
+    const uint64_t nowUs = SteadyClockNowUs();
+    const uint64_t lastUs = _lastArrivalUs.exchange(nowUs, std::memory_order_relaxed);
+    if (lastUs != 0) {
+        const uint64_t intervalUs = nowUs > lastUs ? nowUs - lastUs : 0;
+        const uint64_t avgUs = _avgArrivalIntervalUs.load(std::memory_order_relaxed);
+        _avgArrivalIntervalUs.store(avgUs == 0 ? intervalUs : (avgUs * 7 + intervalUs) / 8,
+                                    std::memory_order_relaxed);
+    }
+    // remember the first request of the batch being collected, its age limits the waiting
+    uint64_t expectedFirstUs = 0;
+    _firstPendingArrivalUs.compare_exchange_strong(expectedFirstUs, nowUs, std::memory_order_relaxed);
+}
+
+unsigned int AutoBatchExecutableNetwork::WorkerInferRequest::CollationTimeoutMs(unsigned int budgetMs) {
+    const uint64_t firstUs = _firstPendingArrivalUs.load(std::memory_order_relaxed);
+    if (firstUs == 0)  // no requests are collected yet, so nothing ages while waiting
+        return budgetMs;
+    const uint64_t budgetUs = static_cast<uint64_t>(budgetMs) * 1000;
+    const uint64_t nowUs = SteadyClockNowUs();
+    const uint64_t elapsedUs = nowUs > firstUs ? nowUs - firstUs : 0;
+    if (elapsedUs >= budgetUs)
+        return 0;
+    uint64_t waitUs = budgetUs - elapsedUs;
+    const uint64_t avgUs = _avgArrivalIntervalUs.load(std::memory_order_relaxed);
+    if (avgUs != 0) {
+        const int vacant = _batchSize - static_cast<int>(_tasks.size());
+        const uint64_t predictedUs = avgUs * static_cast<uint64_t>(vacant > 1 ? vacant : 1);
+        // when the batch is not expected to be filled within the budget of the oldest collected
+        // request, waiting further only adds latency, so the flush should happen right away
+        waitUs = predictedUs > waitUs ? 0 : predictedUs;
+    }
+    // round up, so a sub-millisecond prediction does not turn into a zero (immediate) wait
+    return static_cast<unsigned int>((waitUs + 999) / 1000);
+}
+
+bool AutoBatchExecutableNetwork::WorkerInferRequest::CollationExpired(unsigned int budgetMs) {
+    const uint64_t firstUs = _firstPendingArrivalUs.load(std::memory_order_relaxed);
+    if (firstUs == 0)
+        return false;
+    const uint64_t budgetUs = static_cast<uint64_t>(budgetMs) * 1000;
+    const uint64_t nowUs = SteadyClockNowUs();
+    const uint64_t elapsedUs = nowUs > firstUs ? nowUs - firstUs : 0;
+    if (elapsedUs >= budgetUs)
+        return true;
+    const uint64_t avgUs = _avgArrivalIntervalUs.load(std::memory_order_relaxed);
+    if (avgUs == 0)  // too few arrivals to predict anything, keep collecting until the budget is over
+        return false;
+    const int vacant = _batchSize - static_cast<int>(_tasks.size());
+    const uint64_t predictedUs = avgUs * static_cast<uint64_t>(vacant > 1 ? vacant : 1);
+    return predictedUs > budgetUs - elapsedUs;
+}
+
 InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(
     InferenceEngine::InputsDataMap networkInputs,
     InferenceEngine::OutputsDataMap networkOutputs) {
@@ -525,7 +584,9 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(
+                        lock,
+                        std::chrono::milliseconds(workerRequestPtr->CollationTimeoutMs(_timeOut)));
                 }
                 if (_terminate) {
                     break;
@@ -542,8 +603,11 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        // the batch is flushed, the next arrival will start a new latency budget
+                        workerRequestPtr->_firstPendingArrivalUs = 0;
                         workerRequestPtr->_inferRequestBatched->StartAsync();
-                    } else if ((status == std::cv_status::timeout) && sz) {
+                    } else if ((status == std::cv_status::timeout) && sz &&
+                               workerRequestPtr->CollationExpired(_timeOut)) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
                         // popping all tasks collected by the moment of the time-out and execute each with batch1
@@ -565,9 +629,12 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
                             t.first->_inferRequestWithoutBatch->StartAsync();
                         }
+                        workerRequestPtr->_firstPendingArrivalUs = 0;
                         all_completed_future.get();
                         // now when all the tasks for this batch are completed, start waiting for the timeout again
                     }
+                    // otherwise the adaptive wait just expired early, while the oldest collected
+                    // request still fits the latency budget, so keep collecting the batch
                 }
             }
         });
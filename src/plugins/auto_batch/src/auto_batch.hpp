@@ -47,6 +47,21 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        // observed request arrival statistics, letting the collation thread adapt its wait to the
+        // actual traffic instead of always sleeping for the full configured timeout: moving average
+        // of the inter-arrival interval and the arrival stamp of the oldest not-yet-executed request
+        std::atomic<uint64_t> _avgArrivalIntervalUs = {0};
+        std::atomic<uint64_t> _lastArrivalUs = {0};
+        std::atomic<uint64_t> _firstPendingArrivalUs = {0};
+        // updates the arrival statistics, called for every request scheduled to this worker
+        void RegisterArrival();
+        // how long to wait for the batch to be collated: no longer than the remaining latency
+        // budget of the oldest collected request and no longer than the predicted time to get
+        // the batch filled at the observed arrival rate
+        unsigned int CollationTimeoutMs(unsigned int budgetMs);
+        // whether the collected requests should be flushed in the batch1 mode: the oldest one
+        // exhausted its latency budget, or the batch is not expected to be filled within it
+        bool CollationExpired(unsigned int budgetMs);
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -850,10 +850,13 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{_loadedFromCache};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // every infer request occupies a single subgraph at a time while async requests
+        // execute their subgraphs in a pipelined manner, so to keep all the subgraphs busy
+        // simultaneously the application needs enough requests in flight to cover each of them:
+        // sum the per-subgraph optimal numbers (for a single subgraph it is just the device value)
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (name == ov::execution_devices) {
@@ -6,7 +6,9 @@
 
 #include <ie_blob.h>
 #include <ie_layouts.h>
+#include <ie_remote_context.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <description_buffer.hpp>
 #include <ie_algorithm.hpp>
@@ -45,7 +47,13 @@ void HeteroInferRequest::CreateInferRequest(
         IE_THROW() << "Internal error: no information about network's output/input";
     }
 
-    auto requestBlob([&](const std::string& blobName, InferenceEngine::SoIInferRequestInternal& r, bool output) {
+    // producing and consuming sub requests of every intermediate blob, used to move the blob
+    // into a remote context when the adjacent subgraphs can exchange data without a host copy
+    std::map<std::string, std::pair<SubRequestDesc*, std::string>> intermediateProducers;
+    std::map<std::string, std::vector<std::pair<SubRequestDesc*, std::string>>> intermediateConsumers;
+
+    auto requestBlob([&](const std::string& blobName, SubRequestDesc& desc, bool output) {
+        auto& r = desc._request;
         std::string intermediateBlobName = blobName;
         auto itName = subgraphInputToOutputBlobNames.find(blobName);
         if (itName != subgraphInputToOutputBlobNames.end()) {
@@ -57,12 +65,14 @@ void HeteroInferRequest::CreateInferRequest(
             } else {
                 auto blob = r->GetBlob(blobName);
                 _blobs.emplace(intermediateBlobName, r->GetBlob(blobName));
+                intermediateProducers[intermediateBlobName] = {&desc, blobName};
             }
         } else {
             if (InferenceEngine::details::contains(_networkInputs, blobName)) {
                 _subRequestFromBlobName.emplace(blobName, r);
             } else {
                 r->SetBlob(blobName, _blobs.at(intermediateBlobName));
+                intermediateConsumers[intermediateBlobName].emplace_back(&desc, blobName);
             }
         }
     });
@@ -73,15 +83,64 @@ void HeteroInferRequest::CreateInferRequest(
         desc._request->setModelInputsOutputs(desc._network->getInputs(), desc._network->getOutputs());
         // go over all inputs and get blobs from subnet infer requests
         for (auto&& outputInfo : desc._network->GetOutputsInfo()) {
-            requestBlob(outputInfo.first, desc._request, true);
+            requestBlob(outputInfo.first, desc, true);
         }
     }
 
     // go over all outputs and get blobs from subnet infer requests
     for (auto&& desc : _inferRequests) {
         for (auto&& inputInfo : desc._network->GetInputsInfo()) {
-            requestBlob(inputInfo.first, desc._request, false);
+            requestBlob(inputInfo.first, desc, false);
+        }
+    }
+
+    // when the producing and all the consuming subgraphs sit on a device with the same remote
+    // context, replace the host intermediate blob with a blob allocated on that context, so the
+    // handoff between the subgraphs stays in device memory instead of device->host->device copies
+    auto requestContext = [](const SubRequestDesc& desc) -> InferenceEngine::RemoteContext::Ptr {
+        try {
+            return desc._network->GetContext();
+        } catch (const InferenceEngine::Exception&) {
+            // the device does not work with remote blobs, keep the intermediate blob on host
+            return nullptr;
+        }
+    };
+    for (auto&& producer : intermediateProducers) {
+        auto itConsumers = intermediateConsumers.find(producer.first);
+        if (itConsumers == intermediateConsumers.end()) {
+            continue;
+        }
+        auto producerContext = requestContext(*producer.second.first);
+        if (producerContext == nullptr) {
+            continue;
+        }
+        auto sharable = std::all_of(itConsumers->second.begin(),
+                                    itConsumers->second.end(),
+                                    [&](const std::pair<SubRequestDesc*, std::string>& consumer) {
+                                        auto consumerContext = requestContext(*consumer.first);
+                                        return consumerContext != nullptr &&
+                                               consumerContext->getDeviceName() == producerContext->getDeviceName();
+                                    });
+        if (!sharable) {
+            continue;
+        }
+        InferenceEngine::Blob::Ptr remoteBlob;
+        try {
+            remoteBlob = producerContext->CreateBlob(_blobs.at(producer.first)->getTensorDesc());
+            if (remoteBlob != nullptr) {
+                remoteBlob->allocate();
+            }
+        } catch (const InferenceEngine::Exception&) {
+            remoteBlob = nullptr;
+        }
+        if (remoteBlob == nullptr) {
+            continue;
+        }
+        producer.second.first->_request->SetBlob(producer.second.second, remoteBlob);
+        for (auto&& consumer : itConsumers->second) {
+            consumer.first->_request->SetBlob(consumer.second, remoteBlob);
         }
+        _blobs[producer.first] = remoteBlob;
     }
 }
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <fstream>
@@ -18,6 +19,7 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/op/util/op_types.hpp"
 #include "internal_properties.hpp"
 #include "openvino/util/common_util.hpp"
 // clang-format on
@@ -215,6 +217,48 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const Configs
         }
     }
 
+    // The merge above is greedy: every layer goes to the first device in the fallback list which
+    // supports it. When a lower-priority device executes a long chain of layers and an isolated
+    // layer in the middle of the chain is claimed by a higher-priority device, the chain is cut
+    // into several subgraphs and every boundary tensor travels between the devices. Reassign such
+    // a layer to the device of its neighbours when all of its producers and consumers are assigned
+    // to one other device which supports the layer too: the two extra transfers almost always cost
+    // more than the benefit of running a single layer on the preferred device.
+    for (auto&& node : function->get_ordered_ops()) {
+        auto itAffinity = qr.supportedLayersMap.find(node->get_friendly_name());
+        if (itAffinity == qr.supportedLayersMap.end()) {
+            continue;
+        }
+        std::set<std::string> neighbourDevices;
+        auto collectAffinity = [&](const ov::Node* neighbour) {
+            // constants are duplicated into the subgraphs of their consumers, so they do not
+            // create a boundary between the subgraphs and are ignored here
+            if (ov::op::util::is_constant(neighbour)) {
+                return;
+            }
+            auto it = qr.supportedLayersMap.find(neighbour->get_friendly_name());
+            neighbourDevices.insert(it != qr.supportedLayersMap.end() ? it->second : std::string{});
+        };
+        for (auto&& input : node->inputs()) {
+            collectAffinity(input.get_source_output().get_node());
+        }
+        for (auto&& output : node->outputs()) {
+            for (auto&& input : output.get_target_inputs()) {
+                collectAffinity(input.get_node());
+            }
+        }
+        if (neighbourDevices.size() != 1) {
+            continue;
+        }
+        const auto& neighbourDevice = *neighbourDevices.begin();
+        if (neighbourDevice.empty() || neighbourDevice == itAffinity->second) {
+            continue;
+        }
+        if (queryResults[neighbourDevice].supportedLayersMap.count(node->get_friendly_name()) != 0) {
+            itAffinity->second = neighbourDevice;
+        }
+    }
+
     // set OK status
     qr.rc = StatusCode::OK;
 
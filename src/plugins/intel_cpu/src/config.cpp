@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "cpu/cpu_config.hpp"
@@ -229,6 +230,125 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_DIR) {
+            weightsCacheDir = val;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_ACTIVATIONS_SHARING_DOMAIN) {
+            activationsSharingDomain = val;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_QUASI_STATIC_INPUTS) {
+            quasiStaticInputs.clear();
+            std::istringstream names(val);
+            std::string nameToken;
+            while (std::getline(names, nameToken, ';')) {
+                if (!nameToken.empty())
+                    quasiStaticInputs.push_back(nameToken);
+            }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_IMPL_MANIFEST) {
+            implManifest.clear();
+            std::istringstream entries(val);
+            std::string entryToken;
+            while (std::getline(entries, entryToken, ';')) {
+                if (entryToken.empty())
+                    continue;
+                auto pos = entryToken.rfind(':');
+                if (pos == std::string::npos)
+                    IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_IMPL_MANIFEST
+                               << ". Expected format NodeName:ImplType";
+                implManifest[entryToken.substr(0, pos)] = entryToken.substr(pos + 1);
+            }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_EXEC_PRECISION_POLICY) {
+            execPrecisionPolicy.clear();
+            std::istringstream entries(val);
+            std::string entryToken;
+            while (std::getline(entries, entryToken, ';')) {
+                if (entryToken.empty())
+                    continue;
+                auto pos = entryToken.rfind(':');
+                if (pos == std::string::npos)
+                    IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EXEC_PRECISION_POLICY
+                               << ". Expected format NodeType:Precision";
+                const auto precision = Precision::FromStr(entryToken.substr(pos + 1));
+                if (precision != Precision::FP32 && precision != Precision::BF16)
+                    IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EXEC_PRECISION_POLICY
+                               << ". Supported precisions: FP32, BF16";
+                if (precision == Precision::BF16 && !mayiuse(avx512_core))
+                    IE_THROW() << "Platform doesn't support BF16 format";
+                execPrecisionPolicy[entryToken.substr(0, pos)] = precision;
+            }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_AOT_SHAPES) {
+            aotShapeSets.clear();
+            std::istringstream sets(val);
+            std::string setToken;
+            while (std::getline(sets, setToken, '|')) {
+                std::map<std::string, std::vector<size_t>> shapeSet;
+                std::istringstream inputs(setToken);
+                std::string inputToken;
+                while (std::getline(inputs, inputToken, ';')) {
+                    if (inputToken.empty())
+                        continue;
+                    auto pos = inputToken.rfind(':');
+                    if (pos == std::string::npos)
+                        IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_AOT_SHAPES
+                                   << ". Expected format input_name:dim,dim,...";
+                    std::vector<size_t> dims;
+                    std::istringstream dimsStream(inputToken.substr(pos + 1));
+                    std::string dimToken;
+                    try {
+                        while (std::getline(dimsStream, dimToken, ','))
+                            dims.push_back(std::stoul(dimToken));
+                    } catch (const std::exception&) {
+                        IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_AOT_SHAPES
+                                   << ". Dimensions are expected to be integer numbers";
+                    }
+                    shapeSet[inputToken.substr(0, pos)] = std::move(dims);
+                }
+                if (!shapeSet.empty())
+                    aotShapeSets.push_back(std::move(shapeSet));
+            }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SCRATCH_ARENA) {
+            if (val == PluginConfigParams::YES) {
+                scratchArena = true;
+            } else if (val == PluginConfigParams::NO) {
+                scratchArena = false;
+            } else {
+                // a number enables the arena and caps the retained free memory, in megabytes
+                int val_i;
+                try {
+                    val_i = std::stoi(val);
+                } catch (const std::exception&) {
+                    IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SCRATCH_ARENA
+                               << ". Expected YES/NO or a cap in megabytes";
+                }
+                if (val_i < 0)
+                    IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SCRATCH_ARENA
+                               << ". The cap is expected to be non-negative";
+                scratchArena = true;
+                scratchArenaRetainedCapMB = static_cast<size_t>(val_i);
+            }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_INTRA_STREAM_PARALLELISM) {
+            if (val == PluginConfigParams::YES) intraStreamParallelism = true;
+            else if (val == PluginConfigParams::NO) intraStreamParallelism = false;
+            else IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTRA_STREAM_PARALLELISM
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_NUMA_WEIGHTS_REPLICATION) {
+            if (val == PluginConfigParams::YES) numaWeightsReplication = true;
+            else if (val == PluginConfigParams::NO) numaWeightsReplication = false;
+            else IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_NUMA_WEIGHTS_REPLICATION
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_EXCLUSIVE_CORES) {
+            if (val == PluginConfigParams::YES) exclusiveCores = true;
+            else if (val == PluginConfigParams::NO) exclusiveCores = false;
+            else IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EXCLUSIVE_CORES
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_HUGE_PAGES) {
+            if (val == PluginConfigParams::YES) useHugePages = true;
+            else if (val == PluginConfigParams::NO) useHugePages = false;
+            else IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_HUGE_PAGES
+                << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS_CACHE) {
+            if (val == PluginConfigParams::YES) sharedWeightsCache = true;
+            else if (val == PluginConfigParams::NO) sharedWeightsCache = false;
+            else IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_WEIGHTS_CACHE
+                << ". Expected only YES/NO";
         } else if (key == PluginConfigInternalParams::KEY_SNIPPETS_MODE) {
             if (val == PluginConfigInternalParams::ENABLE)
                 snippetsMode = SnippetsMode::Enable;
@@ -239,6 +359,14 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
                             << ". Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
+        } else if (key == PluginConfigInternalParams::KEY_MEM_REUSE_STRATEGY) {
+            if (val == PluginConfigInternalParams::GREEDY_BY_SIZE)
+                memReuseStrategy = MemReuseStrategy::GreedyBySize;
+            else if (val == PluginConfigInternalParams::BEST_FIT)
+                memReuseStrategy = MemReuseStrategy::BestFit;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_MEM_REUSE_STRATEGY
+                            << ". Expected values: GREEDY_BY_SIZE/BEST_FIT";
         } else if (key == ov::hint::execution_mode.name()) {
             if (val == "PERFORMANCE") {
                 executionMode = ov::hint::ExecutionMode::PERFORMANCE;
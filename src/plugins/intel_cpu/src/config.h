@@ -7,6 +7,7 @@
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
 #include <ie/ie_common.h>
+#include <ie_precision.hpp>
 #include <openvino/runtime/properties.hpp>
 #include <openvino/util/common_util.hpp>
 #include "utils/debug_caps_config.h"
@@ -16,6 +17,7 @@
 #include <string>
 #include <map>
 #include <mutex>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -40,11 +42,30 @@ struct Config {
         Disable,
     };
 
+    enum MemReuseStrategy {
+        GreedyBySize,
+        BestFit,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
+    bool sharedWeightsCache = false;
+    bool intraStreamParallelism = false;
+    bool numaWeightsReplication = false;
+    bool useHugePages = false;
+    bool exclusiveCores = false;
+    bool scratchArena = false;
+    size_t scratchArenaRetainedCapMB = 0;
     bool enableDynamicBatch = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
+    MemReuseStrategy memReuseStrategy = MemReuseStrategy::GreedyBySize;
     std::string dumpToDot = {};
+    std::string weightsCacheDir = {};
+    std::string activationsSharingDomain = {};
+    std::vector<std::string> quasiStaticInputs;
+    std::map<std::string, InferenceEngine::Precision> execPrecisionPolicy;
+    std::map<std::string, std::string> implManifest;
+    std::vector<std::map<std::string, std::vector<size_t>>> aotShapeSets;
     std::string device_id = {};
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
@@ -3,10 +3,15 @@
 //
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <atomic>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 #include <dnnl_types.h>
 #include <common/memory_desc_wrapper.hpp>
 #include "cpu_memory.h"
@@ -32,8 +37,19 @@ namespace {
             }
         }
     }
+
+    constexpr size_t hugePageSize = 2 * 1024 * 1024;
+    std::atomic<bool> hugePagesPolicy{false};
 }   // namespace
 
+void setHugePagesPolicy(bool enabled) {
+    hugePagesPolicy.store(enabled, std::memory_order_relaxed);
+}
+
+bool hugePagesEnabled() {
+    return hugePagesPolicy.load(std::memory_order_relaxed);
+}
+
 Memory::Memory(const dnnl::engine& eng) :
     eng(eng), mgrHandle(std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse())), this), dnnlMemHandle(this) {}
 Memory::Memory(const dnnl::engine& eng, std::unique_ptr<IMemoryMngr> mngr) :
@@ -204,11 +220,32 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
+        size_t allocSize = size;
+        // Growing an existing buffer is the dynamic shape hot path (e.g. the sequence length increasing
+        // by one every decode step), so grow with headroom to amortize the per-step increments to a
+        // logarithmic number of reallocations. The very first allocation stays exact to avoid wasting
+        // memory on buffers that are never resized.
+        if (_data && !_useExternalStorage) {
+            allocSize += allocSize / 2;
+        }
+        void *ptr = nullptr;
+        // Large buffers are aligned to the huge page size and advised as huge page candidates:
+        // backing a multi-gigabyte weight set with 2M pages measurably cuts dTLB misses, while
+        // the advice is silently ignored by kernels without transparent huge pages
+        if (hugePagesEnabled() && allocSize >= hugePageSize) {
+            allocSize = (allocSize + hugePageSize - 1) / hugePageSize * hugePageSize;
+            ptr = dnnl::impl::malloc(allocSize, hugePageSize);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            if (ptr)
+                madvise(ptr, allocSize, MADV_HUGEPAGE);
+#endif
+        } else {
+            ptr = dnnl::impl::malloc(allocSize, cacheLineSize);
+        }
         if (!ptr) {
-            IE_THROW() << "Failed to allocate " << size << " bytes of memory";
+            IE_THROW() << "Failed to allocate " << allocSize << " bytes of memory";
         }
-        _memUpperBound = size;
+        _memUpperBound = allocSize;
         _useExternalStorage = false;
         _data = decltype(_data)(ptr, destroy);
         sizeChanged = true;
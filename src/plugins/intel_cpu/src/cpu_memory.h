@@ -89,6 +89,15 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief Controls the process-wide huge pages allocation policy. When enabled, buffers of 2MB and
+ * above are allocated huge page aligned and advised to the kernel as transparent huge page
+ * candidates. Best effort: without kernel support the advice is ignored and the allocation
+ * behaves as a regular one.
+ */
+void setHugePagesPolicy(bool enabled);
+bool hugePagesEnabled();
+
 /**
  * @brief A proxy object that additionally implements observer pattern
  */
@@ -298,6 +298,18 @@ void get_num_streams(const int streams,
                                                                  model_prefer,
                                                                  proc_type_table);
     executor_config._stream_core_ids = reserve_available_cpus(executor_config._streams_info_table);
+    // Exclusive reservation marks this model's cores busy in the process-wide CPU map, so the
+    // executors of models compiled afterwards keep their stream threads off them. The cores are
+    // returned to the shared pool when the compiled model is destroyed (see ~ExecNetwork).
+    if (config.exclusiveCores) {
+        std::vector<int> reserved_cpu_ids;
+        for (auto& stream_core_ids : executor_config._stream_core_ids) {
+            reserved_cpu_ids.insert(reserved_cpu_ids.end(), stream_core_ids.begin(), stream_core_ids.end());
+        }
+        if (!reserved_cpu_ids.empty()) {
+            set_cpu_used(reserved_cpu_ids, CPU_USED);
+        }
+    }
     executor_config._threadsPerStream = executor_config._streams_info_table[0][THREADS_PER_STREAM];
     executor_config._streams = 0;
     executor_config._threads = 0;
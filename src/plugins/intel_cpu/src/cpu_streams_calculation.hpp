@@ -38,6 +38,11 @@ namespace intel_cpu {
  *               - candidate processors have benn updated based on user input hints like ov::hint::scheduling_core_type
  * in previous function.
  * @return     streams information table which will be used by StreamsExecutor.
+ * @note       The resulting layout is fixed for the lifetime of the compiled model: every stream owns a
+ *             graph whose memory was planned and whose threads were pinned at compile time, so adapting
+ *             to a changing load means recompiling with different hints rather than resizing in place.
+ *             Deployments with a known load range can compile two models with different stream settings
+ *             and route requests between them; the weights can be shared through the weights cache.
  */
 std::vector<std::vector<int>> get_streams_info_table(const int input_streams,
                                                      const int input_threads,
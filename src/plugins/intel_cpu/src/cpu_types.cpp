@@ -182,6 +182,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "GatherTree", Type::GatherTree},
         { "GRN", Type::GRN},
         { "Range", Type::Range},
+        { "RandomUniform", Type::RandomUniform},
         { "Proposal", Type::Proposal},
         { "ReorgYolo", Type::ReorgYolo},
         { "ReverseSequence", Type::ReverseSequence},
@@ -202,6 +203,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "PriorBoxClustered", Type::PriorBoxClustered},
         { "Interaction", Type::Interaction},
         { "MHA", Type::MHA},
+        { "MaskedSoftmax", Type::MaskedSoftmax},
         { "Unique", Type::Unique},
         { "Ngram", Type::Ngram}
 };
@@ -294,6 +296,7 @@ std::string NameFromType(const Type type) {
         CASE(GatherTree);
         CASE(GRN);
         CASE(Range);
+        CASE(RandomUniform);
         CASE(Proposal);
         CASE(ReorgYolo);
         CASE(ReverseSequence);
@@ -311,6 +314,7 @@ std::string NameFromType(const Type type) {
         CASE(PriorBox);
         CASE(PriorBoxClustered)
         CASE(MHA);
+        CASE(MaskedSoftmax);
         CASE(Unique);
         CASE(Ngram);
         CASE(Unknown);
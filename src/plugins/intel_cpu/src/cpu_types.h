@@ -93,6 +93,7 @@ enum class Type {
     GatherTree,
     GRN,
     Range,
+    RandomUniform,
     Proposal,
     ReorgYolo,
     ReverseSequence,
@@ -110,6 +111,7 @@ enum class Type {
     PriorBoxClustered,
     Interaction,
     MHA,
+    MaskedSoftmax,
     Unique,
     Ngram
 };
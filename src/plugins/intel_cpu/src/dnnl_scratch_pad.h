@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
 #include "dnnl_extension_utils.h"
+#include "scratch_pad_arena.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -16,17 +18,47 @@ namespace intel_cpu {
 class DnnlScratchPad {
     DnnlMemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    bool useArena = false;
+    size_t highWatermark = 0;        // largest scratch size the graph has requested
+    int acquireDepth = 0;            // inner graphs (e.g. TensorIterator body) re-enter Infer
+    ScratchPadArena::Block block;    // current checkout, empty between executions
 
 public:
-    DnnlScratchPad(dnnl::engine eng) : eng(eng) {
+    DnnlScratchPad(dnnl::engine eng, bool useArena = false) : eng(eng), useArena(useArena) {
         mgrPtr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        highWatermark = std::max(highWatermark, md->getCurrentMemSize());
         auto mem = std::make_shared<Memory>(eng);
         mem->Create(md, mgrPtr);
         return mem;
     }
+
+    /**
+     * Attaches an arena block for the time of one Infer call. No-op without the arena.
+     * Calls are serialized by the graph lock, so no internal synchronization is needed.
+     */
+    void acquire() {
+        if (!useArena)
+            return;
+        if (acquireDepth++ > 0 || highWatermark == 0)
+            return;
+        block = ScratchPadArena::getInstance().checkout(highWatermark);
+        mgrPtr->setExtBuff(block.data, block.size);
+    }
+
+    /** Returns the arena block once the outermost Infer call completes */
+    void release() {
+        if (!useArena)
+            return;
+        if (--acquireDepth > 0)
+            return;
+        if (block) {
+            ScratchPadArena::getInstance().checkin(block);
+            block = {};
+        }
+    }
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
@@ -353,7 +353,7 @@ std::string Edge::name() const {
     return  result.str();
 }
 
-void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
+void Edge::externalAllocate(WeightsSharing::Ptr weightsCache, const std::string& keyPrefix) {
     if (status != Status::NeedAllocation)
         return;
 
@@ -363,7 +363,7 @@ void Edge::externalAllocate(WeightsSharing::Ptr weightsCache) {
             return memoryPtr;
         };
 
-        auto ptr = weightsCache->findOrCreate(name(), alloc, false);
+        auto ptr = weightsCache->findOrCreate(keyPrefix + name(), alloc, false);
         memoryPtr = *ptr;
         DEBUG_LOG(*this, " memoryPtr=", memoryPtr);
         useExternalMemory = true;
@@ -13,6 +13,7 @@
 #include "itt.h"
 #include "openvino/runtime/intel_cpu/properties.hpp"
 #include "serialize.h"
+#include "utils/debug_capabilities.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
 #include <threading/ie_executor_manager.hpp>
@@ -117,6 +118,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    _streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -138,6 +140,15 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         ExecNetwork::GetGraph();
     }
 
+    if (!_cfg.aotShapeSets.empty() && _cfg.streamExecutorConfig._streams != 0) {
+        // Pre-build primitives for the expected dynamic shapes before the first user request,
+        // from a stream thread so that the right runtime caches are warmed up
+        std::vector<Task> warmup{[this] {
+            WarmupDynamicShapes();
+        }};
+        _taskExecutor->runAndWait(warmup);
+    }
+
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
@@ -162,10 +173,51 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
+ExecNetwork::~ExecNetwork() {
+    // exclusively reserved cores go back to the shared pool, see get_num_streams
+    if (_cfg.exclusiveCores) {
+        std::vector<int> reserved_cpu_ids;
+        for (auto& stream_core_ids : _cfg.streamExecutorConfig._stream_core_ids) {
+            reserved_cpu_ids.insert(reserved_cpu_ids.end(), stream_core_ids.begin(), stream_core_ids.end());
+        }
+        if (!reserved_cpu_ids.empty()) {
+            set_cpu_used(reserved_cpu_ids, NOT_USED);
+        }
+    }
+}
+
+void ExecNetwork::WarmupDynamicShapes() const {
+    auto graphLock = GetGraph();
+    auto& graph = graphLock._graph;
+    if (!graph.hasDynamicInput())
+        return;
+
+    for (const auto& shapeSet : _cfg.aotShapeSets) {
+        try {
+            for (const auto& item : shapeSet) {
+                auto inputNode = graph.getInputNodeByName(item.first);
+                if (!inputNode->isDynamicNode())
+                    continue;
+                inputNode->redefineOutputMemory({item.second});
+                for (size_t i = 0; i < inputNode->getChildEdges().size(); ++i) {
+                    // some operations interpret inputs as indices, so garbage content is not an option
+                    inputNode->getChildEdgeAt(i)->getMemoryPtr()->FillZero();
+                }
+            }
+            // the inference is made for its side effect only: shape specialized primitives
+            // settle in the runtime caches before the first user request arrives
+            graph.Infer();
+        } catch (const InferenceEngine::Exception& e) {
+            // ahead-of-time specialization is best effort, a failed shape set must not fail the compilation
+            DEBUG_LOG("Skipping AOT shapes warmup set: ", e.what());
+        }
+    }
+}
+
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
-    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    auto streamsExecutor = _streamsExecutor;
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
@@ -178,15 +230,26 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                 GraphContext::Ptr ctx;
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
-                    // disable weights caching if graph was created only once
-                    auto weightsCache =
-                        _cfg.streamExecutorConfig._streams != 1 ? _numaNodesWeights[numaNodeId] : nullptr;
+                    WeightsSharing::Ptr weightsCache;
+                    std::string weightsPrefix;
+                    if (_cfg.sharedWeightsCache) {
+                        // process-wide cache deduplicates content-hashed weights across compiled models;
+                        // name-keyed entries stay model-local thanks to the unique prefix
+                        weightsCache = NumaNodesWeights::getProcessShared()[numaNodeId];
+                        weightsPrefix = "model@" + std::to_string(reinterpret_cast<uintptr_t>(this)) + "/";
+                    } else if (_cfg.streamExecutorConfig._streams != 1 || _cfg.numaWeightsReplication) {
+                        // disable weights caching if graph was created only once;
+                        // with replication requested keep the cache anyway, so that constants
+                        // get cloned onto the stream's local NUMA node instead of being read
+                        // from the original model blob across the interconnect
+                        weightsCache = _numaNodesWeights[numaNodeId];
+                    }
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag, weightsPrefix);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -281,15 +344,16 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
-    // @todo Can't we just use local copy (_cfg) instead?
-    auto graphLock = GetGraph();
-    const auto& graph = graphLock._graph;
-    const auto& config = graph.getConfig();
 
     if (isLegacyAPI()) {
-        return GetMetricLegacy(name, graph);
+        auto graphLock = GetGraph();
+        return GetMetricLegacy(name, graphLock._graph);
     }
 
+    // the compiled model configuration is immutable, so the local copy serves all lookups
+    // without taking a stream graph lock against concurrently running requests
+    const auto& config = _cfg;
+
     auto RO_property = [](const std::string& propertyName) {
         return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
     };
@@ -317,9 +381,7 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     }
 
     if (name == ov::model_name) {
-        // @todo Does not seem ok to 'dump()' the whole graph everytime in order to get a name
-        const std::string modelName = graph.dump()->get_friendly_name();
-        return decltype(ov::model_name)::value_type(modelName);
+        return decltype(ov::model_name)::value_type(_name);
     } else if (name == ov::optimal_number_of_infer_requests) {
         const auto streams = config.streamExecutorConfig._streams;
         return decltype(ov::optimal_number_of_infer_requests)::value_type(streams); // ov::optimal_number_of_infer_requests has no negative values
@@ -375,7 +437,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
-    return GetMetricLegacy(name, graph);
+    auto graphLock = GetGraph();
+    return GetMetricLegacy(name, graphLock._graph);
 }
 
 bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const {
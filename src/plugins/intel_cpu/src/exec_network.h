@@ -39,6 +39,8 @@ public:
                 const ExtensionManager::Ptr &extMgr,
                 const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
 
+    ~ExecNetwork() override;
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -58,6 +60,9 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    // cached result of the _taskExecutor downcast: GetGraph() runs on every inference,
+    // so the per-call dynamic_cast is paid once here instead
+    InferenceEngine::IStreamsExecutor*          _streamsExecutor = nullptr;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
         struct Lock : public std::unique_lock<std::mutex> {
@@ -78,6 +83,8 @@ protected:
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
+    void WarmupDynamicShapes() const;
+
     bool isLegacyAPI() const;
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
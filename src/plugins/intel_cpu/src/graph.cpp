@@ -12,6 +12,7 @@
 #include <fstream>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 #include "graph.h"
@@ -20,6 +21,7 @@
 #include "dnnl_extension_utils.h"
 #include "extension_mngr.h"
 #include "memory_solver.hpp"
+#include "workspace_sharing.h"
 #include "itt.h"
 #include "infer_request.h"
 #include "nodes/input.h"
@@ -29,6 +31,7 @@
 #include "nodes/fullyconnected.h"
 
 #include <ie_algorithm.hpp>
+#include "ie_parallel.hpp"
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -194,6 +197,9 @@ void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph) {
 
     if (getConfig().enforceBF16)
         EnforceBF16();
+
+    if (!getConfig().execPrecisionPolicy.empty())
+        EnforceExecPrecisionPolicy();
 }
 
 void Graph::Replicate(const CNNNetwork &network) {
@@ -294,6 +300,9 @@ void Graph::Replicate(const CNNNetwork &network) {
     if (getConfig().enforceBF16)
         EnforceBF16();
 
+    if (!getConfig().execPrecisionPolicy.empty())
+        EnforceExecPrecisionPolicy();
+
     auto hasSubgraphConsumers = [] (const NodePtr& node) -> bool {
         const auto & childEdges = node->getChildEdges();
         return std::any_of(childEdges.begin(), childEdges.end(),
@@ -364,11 +373,19 @@ void Graph::InitGraph() {
     SortTopologically();
 
     bool haveDynNodes = false;
+    for (const auto& node : graphNodes) {
+        haveDynNodes = haveDynNodes || node->isDynamicNode();
+    }
+
+    if (haveDynNodes)
+        MarkShapeComputationNodes();
+
     for (size_t i = 0; i < graphNodes.size(); ++i) {
         const auto& node = graphNodes[i];
         if (node->isDynamicNode()) {
-            haveDynNodes = true;
-            if (node->outputShapeDataDependency() ||
+            // data dependencies fully served by the shape computation lane are resolved during
+            // the shape update sweep, so they do not require a synchronization point
+            if ((node->outputShapeDataDependency() && !node->outputShapeDataDependencyInShapeLane()) ||
                 // WA: for convolution plus sum(broadcast). Due to the fact that a convolution with sum use the same memory for second sum term and the output
                 // tensors (inPlace) resizing the output tensor, may lead to reallocation of this second term memory and possible data lost. The reallocation
                 // may happen when the second term shape is broadcasted to the output tensor shape. To avoid the data loss, we have a special processing for
@@ -388,6 +405,14 @@ void Graph::InitGraph() {
         this->reuse_io_tensors = false;
     }
 
+    if (getConfig().intraStreamParallelism && !haveDynNodes)
+        BuildParallelLevels();
+
+    // memoization relies on result memory staying intact between requests, which only the static
+    // memory reuse scheme can guarantee
+    if (!getConfig().quasiStaticInputs.empty() && !haveDynNodes)
+        MarkQuasiStaticNodes();
+
     Allocate();
 
     CreatePrimitivesAndExecConstants();
@@ -419,37 +444,65 @@ void Graph::InitDescriptors() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
-        node->getSupportedDescriptors();
+    }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
-        node->initSupportedPrimitiveDescriptors();
+    // Descriptor initialization is node-local: it fills the node's own supported descriptor list from
+    // read-only neighbor shapes and precisions, and oneDNN primitive descriptor queries are thread-safe,
+    // so the loop - the dominant part of compile_model on big models - runs in parallel. Descriptor
+    // selection below stays serial since it negotiates with the configs already selected by neighbors.
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "InitSupportedPrimitiveDescriptors");
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    parallel_for(graphNodes.size(), [&](size_t nodeIdx) {
+        const auto& node = graphNodes[nodeIdx];
+        try {
+            DEBUG_LOG("Get supported primitive descriptors for node: ", node->getName());
+            node->getSupportedDescriptors();
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
-        node->filterSupportedPrimitiveDescriptors();
+            DEBUG_LOG("Init supported primitive descriptors for node: ", node->getName());
+            node->initSupportedPrimitiveDescriptors();
+
+            DEBUG_LOG("Filter supported primitive descriptors for node: ", node->getName());
+            node->filterSupportedPrimitiveDescriptors();
 
 #ifdef CPU_DEBUG_CAPS
-        const auto& SPDs = node->getSupportedPrimitiveDescriptors();
-        for (int i = 0; i < SPDs.size(); i++) {
-            DEBUG_LOG("#",
-                      node->getExecIndex(),
-                      " ",
-                      node->getName(),
-                      "  SupportedPrimitiveDescriptors [",
-                      i,
-                      "/",
-                      SPDs.size(),
-                      "]: \n",
-                      SPDs[i]);
-        }
+            const auto& SPDs = node->getSupportedPrimitiveDescriptors();
+            for (int i = 0; i < SPDs.size(); i++) {
+                DEBUG_LOG("#",
+                          node->getExecIndex(),
+                          " ",
+                          node->getName(),
+                          "  SupportedPrimitiveDescriptors [",
+                          i,
+                          "/",
+                          SPDs.size(),
+                          "]: \n",
+                          SPDs[i]);
+            }
 #endif
-    }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!exception)
+                exception = std::current_exception();
+        }
+    });
+    if (exception)
+        std::rethrow_exception(exception);
 
+    const auto& implManifest = getConfig().implManifest;
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
+        if (!implManifest.empty()) {
+            const auto entry = implManifest.find(node->getName());
+            if (entry != implManifest.end()) {
+                // Prepend the recorded implementation so selection prefers it whenever the node
+                // supports it; an unsupported entry falls through to the regular priority order
+                node->implPriorities.insert(node->implPriorities.begin(), parse_impl_name(entry->second));
+                DEBUG_LOG("#", node->getExecIndex(),
+                          " ", node->getName(),
+                          " implementation is pinned to ", entry->second, " by the manifest\n");
+            }
+        }
         DEBUG_LOG("Select optimal primitive descriptors for node: ", node->getName());
         node->selectOptimalPrimitiveDescriptor();
     }
@@ -480,8 +533,131 @@ void Graph::ExtractExecutableNodes() {
                 itr->second = executableGraphNodes.size();
             }
             executableGraphNodes.emplace_back(graphNode);
+            if (!nodeLevels.empty())
+                parallelLevels[nodeLevels[graphNode->getExecIndex()]].emplace_back(graphNode);
         }
     }
+    if (!nodeLevels.empty()) {
+        parallelLevels.erase(std::remove_if(parallelLevels.begin(),
+                                            parallelLevels.end(),
+                                            [](const std::vector<NodePtr>& level) {
+                                                return level.empty();
+                                            }),
+                             parallelLevels.end());
+    }
+}
+
+void Graph::MarkQuasiStaticNodes() {
+    std::unordered_set<const Node*> quasiStaticInputNodes;
+    for (const auto& name : getConfig().quasiStaticInputs) {
+        auto input = inputNodesMap.find(name);
+        if (input == inputNodesMap.end()) {
+            DEBUG_LOG("Quasi-static input '", name, "' is not found among the graph inputs");
+            continue;
+        }
+        quasiStaticInputNodes.insert(input->second.get());
+    }
+    if (quasiStaticInputNodes.empty())
+        return;
+
+    // graphNodes are sorted topologically, so a single forward pass resolves the closure of
+    // nodes fed only by constants and quasi-static inputs
+    for (const auto& node : graphNodes) {
+        if (node->isConstant() || quasiStaticInputNodes.count(node.get()))
+            continue;
+        if (node->getParentEdges().empty() || node->getType() == Type::Output)
+            continue;
+        bool allQuasiStatic = true;
+        for (const auto& parentEdge : node->getParentEdges()) {
+            auto parent = parentEdge.lock()->getParent();
+            if (!parent->isConstant() && !quasiStaticInputNodes.count(parent.get()) &&
+                !quasiStaticNodes.count(parent.get())) {
+                allQuasiStatic = false;
+                break;
+            }
+        }
+        if (allQuasiStatic)
+            quasiStaticNodes.insert(node.get());
+    }
+
+    // A node whose result is overwritten in place by a consumer that keeps executing cannot be
+    // skipped and has to recreate its result on every request. Its own quasi-static consumers
+    // stay skippable: the recomputed content is identical by construction.
+    for (auto it = quasiStaticNodes.begin(); it != quasiStaticNodes.end();) {
+        bool overwritten = false;
+        for (const auto& childEdge : (*it)->getChildEdges()) {
+            auto edge = childEdge.lock();
+            if (edge->inPlace(Edge::LOOK_DOWN) && !quasiStaticNodes.count(edge->getChild().get())) {
+                overwritten = true;
+                break;
+            }
+        }
+        if (overwritten) {
+            it = quasiStaticNodes.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Graph::UpdateQuasiStaticState() {
+    static const SimpleDataHash hasher;
+    uint64_t hash = 0;
+    for (const auto& name : getConfig().quasiStaticInputs) {
+        auto input = inputNodesMap.find(name);
+        if (input == inputNodesMap.end())
+            continue;
+        const auto& memory = input->second->getChildEdgeAt(0)->getMemory();
+        hash = hash * 0x9e3779b97f4a7c15 +
+               hasher.hash(static_cast<const unsigned char*>(memory.GetData()), memory.GetSize());
+    }
+    quasiStaticUpToDate = quasiStaticHashValid && hash == quasiStaticHash;
+    quasiStaticHash = hash;
+    quasiStaticHashValid = true;
+}
+
+void Graph::MarkShapeComputationNodes() {
+    // The ShapeOf->arithmetic->Reshape scaffolding of dynamic models consists of scalar sized
+    // integer tensors, yet every micro node in it takes a full trip through the execution
+    // pipeline and forces a synchronization point on each value dependent consumer. The nodes
+    // marked here form the shape computation lane: they are executed inline during the shape
+    // update sweep (see UpdateNodes in InferDynamic), so by the time a consumer runs its shape
+    // inference the values are already available and the main execution loop skips the lane.
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        if (node->getType() == Type::ShapeOf) {
+            // ShapeOf reads nothing but the dims of the input memory, which are defined right
+            // after the producer has updated its own shapes, so it always starts a lane
+            node->markShapeComputationNode();
+            continue;
+        }
+        if (node->getType() == Type::Input || node->getType() == Type::Output ||
+            node->getParentEdges().empty())
+            continue;
+        // the rank limit keeps everything but the scalar shape arithmetic out of the lane
+        bool suitable = true;
+        for (size_t port = 0; port < node->getParentEdges().size(); ++port) {
+            suitable = suitable && node->getInputShapeAtPort(port).getRank() <= 1;
+        }
+        for (const auto& childEdge : node->getChildEdges()) {
+            suitable = suitable && node->getOutputShapeAtPort(childEdge.lock()->getInputNum()).getRank() <= 1;
+        }
+        if (!suitable)
+            continue;
+        bool hasLaneParent = false;
+        for (const auto& parentEdge : node->getParentEdges()) {
+            auto parent = parentEdge.lock()->getParent();
+            if (parent->isShapeComputationNode()) {
+                hasLaneParent = true;
+            } else if (!parent->isConstant()) {
+                suitable = false;
+                break;
+            }
+        }
+        if (suitable && hasLaneParent)
+            node->markShapeComputationNode();
+    }
 }
 
 void Graph::CreatePrimitivesAndExecConstants() const {
@@ -499,7 +675,7 @@ void Graph::CreatePrimitivesAndExecConstants() const {
             auto edgePtr = node->getChildEdgeAt(i);
             if (edgePtr) {
                 if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = context->getWeightsCache()->get(edgePtr->name());
+                    auto ptr = context->getWeightsCache()->get(context->getWeightsPrefix() + edgePtr->name());
                     outputs.emplace_back(ptr);
                     if (!ptr->isValid())
                         hasExternalInvalidEdges = true;
@@ -692,7 +868,7 @@ void Graph::AllocateWithReuse() {
                     auto constNode = std::static_pointer_cast<node::Input>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<Memory>(constNode->getMemoryPtr()));
                 } else {
-                    edge->externalAllocate(context->getWeightsCache());
+                    edge->externalAllocate(context->getWeightsCache(), context->getWeightsPrefix());
                 }
                 erase = true;
             }
@@ -719,6 +895,13 @@ void Graph::AllocateWithReuse() {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
 
+            if (!nodeLevels.empty()) {
+                // nodes of one level run concurrently, so the tensor must stay alive across
+                // the whole span of the levels of its producer and of its last consumer
+                e_start = levelSpans[nodeLevels[e_start]].first;
+                e_finish = levelSpans[nodeLevels[e_finish]].second;
+            }
+
             if (boxSize != -1 && edge->getDesc().isDefined()) {
                 int64_t e_size = edge->getDesc().getCurrentMemSize();  // size in bytes (from the beginning of data to the last element)
                 boxSize = std::max(e_size, boxSize);
@@ -733,11 +916,15 @@ void Graph::AllocateWithReuse() {
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
+        bool isConst = false, isOutput = false, isInput = false, isQuasiStatic = false, isShapeLane = false,
+             isState = false;
         for (auto &edge : edge_clusters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Type::Output;
             isInput  |= edge->getParent()->getType() == Type::Input;
+            isQuasiStatic |= quasiStaticNodes.count(edge->getParent().get()) != 0;
+            isShapeLane |= edge->getParent()->isShapeComputationNode();
+            isState  |= edge->getParent()->getType() == Type::MemoryInput;
         }
 
         if (reuse_io_tensors) {
@@ -750,6 +937,27 @@ void Graph::AllocateWithReuse() {
             }
         }
 
+        // quasi-static results must survive across requests while their producers are skipped,
+        // so they are excluded from reuse the same way constant data is
+        if (isQuasiStatic) {
+            box.start = 0;
+            box.finish = -1;
+        }
+
+        // the shape computation lane executes during the shape update sweep, i.e. ahead of the
+        // execution order the reuse intervals are built from, so its results must not share
+        // memory with tensors that are still alive earlier in the main execution loop
+        if (isShapeLane) {
+            box.start = 0;
+        }
+
+        // state tensors must survive across infer requests when the state store aliases
+        // the edge memory, see MemoryInput::createPrimitive
+        if (isState) {
+            box.start = 0;
+            box.finish = -1;
+        }
+
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
             definedBoxes.push_back(box);
@@ -760,10 +968,19 @@ void Graph::AllocateWithReuse() {
     }
 
     MemorySolver staticMemSolver(definedBoxes);
-    size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
-
-    memWorkspace = std::make_shared<Memory>(getEngine());
-    memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    size_t total_size = static_cast<size_t>(getConfig().memReuseStrategy == Config::MemReuseStrategy::BestFit
+                                                ? staticMemSolver.solveBestFit()
+                                                : staticMemSolver.solve()) * alignment;
+
+    // An activation sharing domain replaces the private workspace with a process-shared one.
+    // Streams of one compiled model run concurrently over their own graph copies, so sharing
+    // is only applied to single-stream configurations.
+    if (!getConfig().activationsSharingDomain.empty() && getConfig().streamExecutorConfig._streams <= 1) {
+        memWorkspace = WorkspaceSharing::getWorkspace(getConfig().activationsSharingDomain, total_size, getEngine());
+    } else {
+        memWorkspace = std::make_shared<Memory>(getEngine());
+        memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
+    }
 
     if (edge_clusters.empty())
         return;
@@ -998,9 +1215,17 @@ void Graph::PullOutputData(BlobMap &out) {
 }
 
 void Graph::InferStatic(InferRequestBase* request) {
+    if (!parallelLevels.empty()) {
+        InferStaticParallel(request);
+        return;
+    }
+
     dnnl::stream stream(getEngine());
 
     for (const auto& node : executableGraphNodes) {
+        if (quasiStaticUpToDate && quasiStaticNodes.count(node.get()))
+            continue;
+
         VERBOSE(node, getConfig().debugCaps.verbose);
         PERF(node, getConfig().collectPerfCounters);
 
@@ -1010,6 +1235,71 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferStaticParallel(InferRequestBase* request) {
+    dnnl::stream stream(getEngine());
+
+    for (const auto& level : parallelLevels) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (level.size() == 1) {
+            const auto& node = level.front();
+            if (quasiStaticUpToDate && quasiStaticNodes.count(node.get()))
+                continue;
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        std::exception_ptr exception;
+        std::mutex exceptionMutex;
+        parallel_for(level.size(), [&](size_t i) {
+            const auto& node = level[i];
+            if (quasiStaticUpToDate && quasiStaticNodes.count(node.get()))
+                return;
+            VERBOSE(node, getConfig().debugCaps.verbose);
+            PERF(node, getConfig().collectPerfCounters);
+            try {
+                ExecuteNode(node, stream);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        });
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+}
+
+void Graph::BuildParallelLevels() {
+    // Wavefront decomposition of the topologically sorted graph: a node level is one more
+    // than the deepest level among its parents, hence nodes of equal level never depend on
+    // each other and are safe to dispatch concurrently.
+    nodeLevels.assign(graphNodes.size(), 0);
+    int maxLevel = 0;
+    for (size_t i = 0; i < graphNodes.size(); ++i) {
+        const auto& node = graphNodes[i];
+        int level = 0;
+        for (size_t j = 0; j < node->getParentEdges().size(); ++j) {
+            const auto parent = node->getParentEdgeAt(j)->getParent();
+            level = std::max(level, nodeLevels[parent->getExecIndex()] + 1);
+        }
+        nodeLevels[i] = level;
+        maxLevel = std::max(maxLevel, level);
+    }
+
+    levelSpans.assign(maxLevel + 1, {std::numeric_limits<int>::max(), 0});
+    for (size_t i = 0; i < graphNodes.size(); ++i) {
+        auto& span = levelSpans[nodeLevels[i]];
+        span.first = std::min(span.first, static_cast<int>(i));
+        span.second = std::max(span.second, static_cast<int>(i));
+    }
+
+    parallelLevels.assign(levelSpans.size(), {});
+}
+
 namespace {
 
 class IUpdateNodes {
@@ -1020,7 +1310,8 @@ public:
 
 class UpdateNodesSeq : public IUpdateNodes {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes, const dnnl::stream& stream)
+        : m_executableGraphNodes(executableGraphNodes), m_stream(stream) {}
     void run(size_t stopIndx) override {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
@@ -1028,12 +1319,22 @@ public:
                 node->updateShapes();
                 node->updateDynamicParams();
             }
+            if (node->isShapeComputationNode()) {
+                // the shape computation lane runs inline so that its values are in place
+                // before the shape inference of the downstream nodes in the same sweep
+                if (node->isDynamicNode()) {
+                    node->executeDynamic(m_stream);
+                } else {
+                    node->execute(m_stream);
+                }
+            }
         }
     }
 
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    dnnl::stream m_stream;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1043,7 +1344,8 @@ private:
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_OMP)
 class UpdateNodesBase : public IUpdateNodes {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes, const dnnl::stream& stream)
+        : m_executableGraphNodes(executableGraphNodes), m_stream(stream) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
@@ -1051,6 +1353,16 @@ public:
                 if (node->isDynamicNode()) {
                     node->updateShapes();
                 }
+                if (node->isShapeComputationNode()) {
+                    // the shape computation lane runs inline so that its values are in place
+                    // before the shape inference of the downstream nodes in the same sweep
+                    if (node->isDynamicNode()) {
+                        node->updateDynamicParams();
+                        node->executeDynamic(m_stream);
+                    } else {
+                        node->execute(m_stream);
+                    }
+                }
                 m_prepareCounter.store(i, std::memory_order::memory_order_release);
             }
         }
@@ -1072,7 +1384,7 @@ public:
             }
             while (local_counter < prepareCounter) {
                 const auto& node = m_executableGraphNodes[local_counter++];
-                if (node->isDynamicNode()) {
+                if (node->isDynamicNode() && !node->isShapeComputationNode()) {
                     node->updateDynamicParams();
                 }
             }
@@ -1220,9 +1532,9 @@ void Graph::InferDynamic(InferRequestBase* request) {
 
     std::unique_ptr<IUpdateNodes> updateNodes{};
     if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, stream));
     } else {
-        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
+        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes, stream));
     }
     size_t inferCounter = 0;
 
@@ -1230,6 +1542,8 @@ void Graph::InferDynamic(InferRequestBase* request) {
         updateNodes->run(stopIndx);
         for (; inferCounter < stopIndx; ++inferCounter) {
             auto& node = executableGraphNodes[inferCounter];
+            if (node->isShapeComputationNode())
+                continue;   // already executed inline by the shape update sweep
             VERBOSE(node, getConfig().debugCaps.verbose);
             PERF(node, getConfig().collectPerfCounters);
 
@@ -1258,13 +1572,24 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
-    if (Status::ReadyDynamic == status) {
-        InferDynamic(request);
-    } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
-    } else {
-        IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
+    if (!quasiStaticNodes.empty())
+        UpdateQuasiStaticState();
+
+    auto scratchPad = context->getScratchPad();
+    scratchPad->acquire();
+    try {
+        if (Status::ReadyDynamic == status) {
+            InferDynamic(request);
+        } else if (Status::ReadyStatic == status) {
+            InferStatic(request);
+        } else {
+            IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
+        }
+    } catch (...) {
+        scratchPad->release();
+        throw;
     }
+    scratchPad->release();
 
     if (infer_count != -1) infer_count++;
 }
@@ -1287,7 +1612,7 @@ void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     node->permanent = true;
     node->temporary = false;
 
-    sortedNodes.insert(sortedNodes.begin(), node);
+    sortedNodes.push_back(node);
 }
 
 void Graph::SortTopologically() {
@@ -1312,6 +1637,9 @@ void Graph::SortTopologically() {
         VisitNode(node, sorted);
     }
 
+    // VisitNode appends in post order, the execution order is the reverse of it
+    std::reverse(sorted.begin(), sorted.end());
+
     for (int i = 0; i < sorted.size(); i++) sorted[i]->execIndex = i;
 
     graphNodes.erase(graphNodes.begin(), graphNodes.end());
@@ -1665,6 +1993,40 @@ void Graph::EnforceBF16() {
     }
 }
 
+void Graph::EnforceExecPrecisionPolicy() {
+    /* Pin the execution precision of the listed node types regardless of the global inference
+     * precision: a type mapped to BF16 runs in BF16 even when the graph stays in FP32, and a type
+     * mapped to FP32 is excluded from the BF16 enforcement above. Runs after EnforceBF16 so the
+     * policy always has the last word for the types it names */
+    const auto& policy = getConfig().execPrecisionPolicy;
+    for (const auto& node : graphNodes) {
+        if (node->getType() == Type::Input || node->getType() == Type::Output)
+            continue;
+
+        const auto entry = policy.find(NameFromType(node->getType()));
+        if (entry == policy.end())
+            continue;
+        const auto precision = entry->second;
+
+        DEBUG_LOG("#", node->getExecIndex(),
+                  " ", node->getName(),
+                  " is pinned to ", precision.name(), " by the precision policy\n");
+        for (size_t i = 0; i < node->getOriginalInputsNumber(); i++) {
+            const auto& parent = node->getParentEdgesAtPort(i)[0]->getParent();
+            // constant inputs (weights, scales) keep their original precision, same as in EnforceBF16
+            if (parent->getType() == Type::Input && parent->isConstant())
+                continue;
+            if (one_of(node->getOriginalInputPrecisionAtPort(i), Precision::FP32, Precision::BF16))
+                node->setOriginalInputPrecisionAtPort(i, precision);
+        }
+
+        for (size_t i = 0; i < node->getOriginalOutputsNumber(); i++) {
+            if (one_of(node->getOriginalOutputPrecisionAtPort(i), Precision::FP32, Precision::BF16))
+                node->setOriginalOutputPrecisionAtPort(i, precision);
+        }
+    }
+}
+
 std::shared_ptr<ngraph::Function> Graph::dump() const {
     return dump_graph_as_ie_ngraph_net(*this);
 }
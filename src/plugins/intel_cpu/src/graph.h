@@ -15,6 +15,7 @@
 #include "graph_context.h"
 #include <map>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 #include <atomic>
@@ -242,9 +243,14 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
+    void BuildParallelLevels();
+    void MarkQuasiStaticNodes();
+    void UpdateQuasiStaticState();
+    void MarkShapeComputationNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(InferRequestBase* request);
+    void InferStaticParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
     friend class LegacyInferRequest;
@@ -262,8 +268,21 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> executableGraphNodes;
 
+    // wavefront decomposition of a static graph for the intra stream parallelism:
+    // nodes of one level never depend on each other and may run concurrently
+    std::vector<std::vector<NodePtr>> parallelLevels;
+    std::vector<int> nodeLevels;                   // level by exec index
+    std::vector<std::pair<int, int>> levelSpans;   // [min, max] exec index per level
+
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // nodes fed only by constants and the configured quasi-static inputs; their results are
+    // kept between requests and they are skipped while the input content hash is unchanged
+    std::unordered_set<const Node*> quasiStaticNodes;
+    uint64_t quasiStaticHash = 0;
+    bool quasiStaticHashValid = false;
+    bool quasiStaticUpToDate = false;
+
     GraphContext::CPtr context;
 
     // this field stores the dynamic batch value to provide backward compatibility
@@ -271,6 +290,7 @@ private:
     int dynBatch = -1;
 
     void EnforceBF16();
+    void EnforceExecPrecisionPolicy();
 };
 
 }   // namespace intel_cpu
@@ -9,6 +9,7 @@
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
+#include "weights_disk_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -21,13 +22,22 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 std::string weightsPrefix = {})
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          weightsPrefix(std::move(weightsPrefix)),
           isGraphQuantizedFlag(isGraphQuantized) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-        rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+        rtScratchPad = std::make_shared<DnnlScratchPad>(eng, config.scratchArena);
+        if (config.scratchArena && config.scratchArenaRetainedCapMB)
+            ScratchPadArena::getInstance().setRetainedCap(config.scratchArenaRetainedCapMB * 1024 * 1024);
+        // the page policy is process-wide: once some model opts in it stays on
+        if (config.useHugePages)
+            setHugePagesPolicy(true);
+        if (!config.weightsCacheDir.empty())
+            weightsDiskCache = std::make_shared<WeightsDiskCache>(config.weightsCacheDir);
     }
 
     const Config& getConfig() const {
@@ -42,6 +52,14 @@ public:
         return weightsCache;
     }
 
+    WeightsDiskCache::Ptr getWeightsDiskCache() const {
+        return weightsDiskCache;
+    }
+
+    const std::string& getWeightsPrefix() const {
+        return weightsPrefix;
+    }
+
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
@@ -64,6 +82,8 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsDiskCache::Ptr weightsDiskCache;   // optional persistent store of reordered weights
+    std::string weightsPrefix;                // isolates name-keyed entries within a process-shared cache
 
     MultiCachePtr rtParamsCache;     // primitive cache
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
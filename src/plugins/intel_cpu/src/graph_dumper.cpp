@@ -108,6 +108,64 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    // Roofline inputs: bytes moved are taken from the selected descriptor memory sizes, flops are
+    // estimated from shapes for the primitive types where the formula is determined by them. The
+    // keys are omitted when shapes are dynamic, so consumers treat absence as "unknown"
+    const auto& config = node->getSelectedPrimitiveDescriptor()->getConfig();
+    size_t dataBytes = 0;
+    bool sizesDefined = true;
+    auto addPortBytes = [&](const std::vector<PortConfig>& confs) {
+        for (const auto& conf : confs) {
+            const auto& desc = conf.getMemDesc();
+            if (!desc->hasDefinedMaxSize()) {
+                sizesDefined = false;
+                return;
+            }
+            dataBytes += desc->getMaxMemSize();
+        }
+    };
+    addPortBytes(config.inConfs);
+    if (sizesDefined)
+        addPortBytes(config.outConfs);
+    if (sizesDefined)
+        serialization_info[ExecGraphInfoSerialization::DATA_BYTES] = std::to_string(dataBytes);
+
+    auto staticElements = [](const MemoryDescPtr& desc, uint64_t& count) {
+        if (!desc->getShape().isStatic())
+            return false;
+        count = desc->getShape().getElementsCount();
+        return true;
+    };
+    const auto type = node->getType();
+    uint64_t flops = 0;
+    bool flopsKnown = false;
+    if ((type == Type::Convolution || type == Type::Deconvolution || type == Type::FullyConnected) &&
+        config.inConfs.size() > 1 && !config.outConfs.empty()) {
+        // 2 * output elements * multiply-accumulates per output element; the latter is derived
+        // from the weights tensor, which accounts for both groups and the kernel volume
+        uint64_t outElems = 0, weiElems = 0;
+        const auto& outShape = config.outConfs[0].getMemDesc()->getShape();
+        if (staticElements(config.outConfs[0].getMemDesc(), outElems) &&
+            staticElements(config.inConfs[1].getMemDesc(), weiElems)) {
+            const auto& outDims = outShape.getStaticDims();
+            const auto outChannels =
+                type == Type::FullyConnected ? outDims.back() : (outShape.getRank() > 1 ? outDims[1] : 1);
+            if (outChannels) {
+                flops = 2 * outElems * (weiElems / outChannels);
+                flopsKnown = true;
+            }
+        }
+    } else if (type == Type::MatMul && !config.inConfs.empty() && !config.outConfs.empty()) {
+        uint64_t outElems = 0;
+        const auto& inShape = config.inConfs[0].getMemDesc()->getShape();
+        if (staticElements(config.outConfs[0].getMemDesc(), outElems) && inShape.isStatic()) {
+            flops = 2 * outElems * inShape.getStaticDims().back();
+            flopsKnown = true;
+        }
+    }
+    if (flopsKnown)
+        serialization_info[ExecGraphInfoSerialization::ESTIMATED_FLOPS] = std::to_string(flops);
+
     return serialization_info;
 }
 
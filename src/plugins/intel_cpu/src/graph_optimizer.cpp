@@ -1811,42 +1811,54 @@ void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
 
 void GraphOptimizer::DropDoubleReorders(Graph &graph) {
     std::set<NodePtr> processed;
-    std::size_t graphNodesSize = graph.GetNodes().size();
-    for (std::size_t i = 0; i < graphNodesSize; i++) {
-        NodePtr& node = graph.GetNodes()[i];
-        if (processed.find(node) == processed.end() && node->getType() == Type::Reorder
-            && node->getChildEdges().size() == 1
-            && node->getChildEdgeAt(0)->getChild()->getType() == Type::Reorder ) {
-            auto nextNode = node->getChildEdgeAt(0)->getChild();
-            Reorder* n = dynamic_cast<Reorder*>(node.get());
-            if (n == nullptr)
-                IE_THROW() << "Cannot get reorder layer " << node->getName();
-            Reorder* nn = dynamic_cast<Reorder*>(nextNode.get());
-            if (nn == nullptr)
-                IE_THROW() << "Cannot get reorder layer " << nextNode->getName();
-
-            NodePtr p = n->getParentEdgesAtPort(0)[0]->getParent();
-            NodePtr c = nn->getChildEdgesAtPort(0)[0]->getChild();
-
-            auto oldEdgeNum = n->getParentEdgesAtPort(0)[0]->getInputNum();
-
-            graph.DropNode(node);
-            graph.DropNode(nextNode);
-
-            processed.insert(node);
-            processed.insert(nextNode);
-
-            EdgePtr edge;
-            for (auto& cur : p->getChildEdgesAtPort(oldEdgeNum)) {
-                if (cur->getChild() == c)
-                    edge = cur;
-            }
-            if (!edge) IE_THROW() << "Inappropriate graph processing";
+    bool merged = true;
+    // a merged reorder is appended past the end of the traversed range, so iterate to a fixed point
+    // to collapse chains longer than two reorders
+    while (merged) {
+        merged = false;
+        std::size_t graphNodesSize = graph.GetNodes().size();
+        for (std::size_t i = 0; i < graphNodesSize; i++) {
+            NodePtr& node = graph.GetNodes()[i];
+            if (processed.find(node) == processed.end() && node->getType() == Type::Reorder
+                && node->getChildEdges().size() == 1
+                && node->getChildEdgeAt(0)->getChild()->getType() == Type::Reorder ) {
+                auto nextNode = node->getChildEdgeAt(0)->getChild();
+                Reorder* n = dynamic_cast<Reorder*>(node.get());
+                if (n == nullptr)
+                    IE_THROW() << "Cannot get reorder layer " << node->getName();
+                Reorder* nn = dynamic_cast<Reorder*>(nextNode.get());
+                if (nn == nullptr)
+                    IE_THROW() << "Cannot get reorder layer " << nextNode->getName();
+
+                NodePtr p = n->getParentEdgesAtPort(0)[0]->getParent();
+                NodePtr c = nn->getChildEdgesAtPort(0)[0]->getChild();
+
+                auto oldEdgeNum = n->getParentEdgesAtPort(0)[0]->getInputNum();
+
+                graph.DropNode(node);
+                graph.DropNode(nextNode);
+
+                processed.insert(node);
+                processed.insert(nextNode);
+                merged = true;
+
+                EdgePtr edge;
+                for (auto& cur : p->getChildEdgesAtPort(oldEdgeNum)) {
+                    if (cur->getChild() == c)
+                        edge = cur;
+                }
+                if (!edge) IE_THROW() << "Inappropriate graph processing";
 
+                // a pair that round-trips to the original layout (e.g. nchw -> blocked -> nchw) is an overall
+                // identity, so keep the direct producer-consumer edge instead of inserting a merged reorder
+                if (n->getInput().isCompatible(nn->getOutput())) {
+                    continue;
+                }
 
-            std::string layerName = edge->getParent()->getName() + "_ScaleReorder_" + edge->getChild()->getName();
-            graph.InsertReorder(edge, layerName, n->getInput(), nn->getOutput(), false);
-            graph.GetEdges().erase(std::remove(graph.GetEdges().begin(), graph.GetEdges().end(), edge), graph.GetEdges().end());
+                std::string layerName = edge->getParent()->getName() + "_ScaleReorder_" + edge->getChild()->getName();
+                graph.InsertReorder(edge, layerName, n->getInput(), nn->getOutput(), false);
+                graph.GetEdges().erase(std::remove(graph.GetEdges().begin(), graph.GetEdges().end(), edge), graph.GetEdges().end());
+            }
         }
     }
 }
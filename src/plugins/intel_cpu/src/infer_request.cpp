@@ -107,7 +107,9 @@ void InferRequestBase::PushStates() {
                     auto data_size = state->GetState()->byteSize();
                     auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    // the state blob usually aliases the store, nothing to synchronize then
+                    if (data_ptr != cur_state_mem_buf)
+                        cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
                 }
             }
         }
@@ -129,7 +131,9 @@ void InferRequestBase::PullStates() {
                     auto data_size = state->GetState()->byteSize();
                     auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                    // the state blob usually aliases the store, nothing to synchronize then
+                    if (data_ptr != cur_state_mem_buf)
+                        cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
                 }
             }
         }
@@ -182,6 +186,10 @@ void InferRequestBase::InferImpl() {
 
     ThrowIfCanceled();
 
+    // Output conversion/copy-out must finish before the stream thread is released: the graph instance
+    // (including the memory the output edges point to) is reused by the next request scheduled on this
+    // stream, so deferring PullOutputData to a helper executor would race with that request overwriting
+    // the outputs. Precision conversion itself is already multi-threaded inside cpu_convert.
     graph->PullOutputData(_outputs);
 }
 
@@ -705,6 +713,9 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
             actualDesc = actualDesc->cloneWithNewDims(blobDesc.getLayout() == InferenceEngine::Layout::SCALAR ? InferenceEngine::SizeVector{1} :
                                                                                                                 blobDesc.getDims());
         }
+        // Zero-copy path: the user buffer is referenced directly via externalPtr when its layout matches the
+        // graph input descriptor. ROI views sliced along the outermost dimension keep default strides and pass
+        // this check as well; non-dense views (inner-dimension slices) fall back to the copy in PushInputData.
         if (actualDesc->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(blobDesc)) &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getConfig().batchLimit) {
             externalPtr[name] = data->buffer();
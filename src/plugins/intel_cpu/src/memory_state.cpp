@@ -12,9 +12,16 @@ namespace ov {
 namespace intel_cpu {
 
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    std::memset(storage->GetData(), 0, storage->GetSize());
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (newState->byteSize() != storage->GetSize())
+        IE_THROW() << "Cannot set variable state " << GetName() << ": blob size " << newState->byteSize()
+                   << " doesn't match the state size " << storage->GetSize();
+    // user data is copied into the store once here, the per-infer path stays copy free
+    cpu_memcpy(storage->GetData(), newState->cbuffer().as<const void*>(), newState->byteSize());
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -18,13 +18,20 @@ namespace intel_cpu {
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
     VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+        : InferenceEngine::IVariableStateInternal{name},
+          storage(storage) {
+        // the blob aliases the graph-side store instead of copying it, so the state
+        // (e.g. a growing KV cache) is appended to in place and Get/SetState stay
+        // zero-copy; the store outlives the graph edges, it is a dedicated memory
+        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()),
+                                         storage->GetData());
     }
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+private:
+    MemoryPtr storage;
 };
 
 }   // namespace intel_cpu
@@ -592,27 +592,59 @@ bool Node::outputShapeDataDependency() const {
     return false;
 }
 
+bool Node::outputShapeDataDependencyInShapeLane() const {
+    auto port_mask = shapeInference->get_port_mask();
+    if (EMPTY_PORT_MASK != port_mask) {
+        for (size_t i = 0; i < getParentEdges().size(); ++i) {
+            if (port_mask & (1 << i)) {
+                const auto parent = getParentEdgeAt(i)->getParent();
+                if (!parent->isConstant() && !parent->isShapeComputationNode()) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 void Node::redefineOutputMemory(const std::vector<VectorDims> &newOutputShapes) {
     if (newOutputShapes.size() != outputShapes.size()) {
         IE_THROW() << "Number shapes mismatch with real outputs number for node with name: " << getName();
     }
     for (size_t i = 0; i < outputShapes.size(); i++) {
-        const auto edges = getChildEdgesAtPort(i);
-
         // avoid 0D shape incompatible
         auto newOutputShape = newOutputShapes[i];
         if (newOutputShape.empty()) {
             newOutputShape.push_back(1);
         }
 
-        const auto &currDesc = edges[0]->getMemory().getDesc();
+        // this runs for every dynamic node on every request, so the child edges are walked in
+        // place instead of materializing a vector of locked pointers per port per call
+        EdgePtr firstEdge;
+        for (auto& edge_w : childEdges) {
+            auto edge = edge_w.lock();
+            if (!edge)
+                IE_THROW() << "Node " << getName() << " contains dead weak ptr";
+            if (edge->getInputNum() == static_cast<int>(i)) {
+                firstEdge = edge;
+                break;
+            }
+        }
+        if (!firstEdge)
+            IE_THROW() << "Node " << getName() << " has no child edge at output port " << i;
+
+        const auto &currDesc = firstEdge->getMemory().getDesc();
         if (currDesc.getShape().isStatic() && currDesc.getShape().getStaticDims() == newOutputShape)
             continue;
 
         const bool hasZeroDims = std::count(std::begin(newOutputShape), std::end(newOutputShape), 0) > 0;
         const auto memDesc = getBaseMemDescAtOutputPort(i)->cloneWithNewDims(newOutputShape, hasZeroDims);
-        for (size_t j = 0; j < edges.size(); j++) {
-            edges[j]->getMemoryPtr()->redefineDesc(memDesc);
+        for (auto& edge_w : childEdges) {
+            auto edge = edge_w.lock();
+            if (!edge)
+                IE_THROW() << "Node " << getName() << " contains dead weak ptr";
+            if (edge->getInputNum() == static_cast<int>(i))
+                edge->getMemoryPtr()->redefineDesc(memDesc);
         }
     }
 }
@@ -803,12 +835,28 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
         const uint64_t data_hash = weightCache->GetHashFunc().hash(
                 internalBlob->buffer(), internalBlob->byteSize());
 
-        const std::string string_hash = name + "_" + std::to_string(indx)
+        // node names are model-local; the process-shared cache keys weights purely by content
+        // so that identical blobs are deduplicated across compiled models
+        const std::string string_hash = (context->getConfig().sharedWeightsCache ? std::string("shared") : name)
+                                        + "_" + std::to_string(indx)
                                         + "_" + format
                                         + "_" + std::to_string(internalBlob->byteSize())
                                         + "_" + std::to_string(data_hash);
 
-        ptr = *weightCache->findOrCreate(string_hash, create);
+        auto diskCache = context->getWeightsDiskCache();
+        if (diskCache) {
+            // the key is built from the content hash, so a blob stored by another process is reusable here
+            auto loadOrCreate = [&] () {
+                if (auto loaded = diskCache->load(string_hash, intDesc, engine))
+                    return loaded;
+                auto created = create();
+                diskCache->store(string_hash, *created);
+                return created;
+            };
+            ptr = *weightCache->findOrCreate(string_hash, loadOrCreate);
+        } else {
+            ptr = *weightCache->findOrCreate(string_hash, create);
+        }
     } else {
         ptr = create();
     }
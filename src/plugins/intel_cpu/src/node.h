@@ -366,6 +366,7 @@ public:
     void executeDynamic(dnnl::stream strm);
     virtual void redefineOutputMemory(const std::vector<VectorDims> &newShapes);
     bool outputShapeDataDependency() const;
+    bool outputShapeDataDependencyInShapeLane() const;
 
     virtual void initSupportedPrimitiveDescriptors();
 
@@ -511,6 +512,14 @@ public:
         return isDynamic;
     }
 
+    bool isShapeComputationNode() const {
+        return shapeComputationNode;
+    }
+
+    void markShapeComputationNode() {
+        shapeComputationNode = true;
+    }
+
     const Shape& getInputShapeAtPort(size_t port) const {
         if (inputShapes.size() <= port) {
             IE_THROW() << "Incorrect input port number for node " << getName();
@@ -649,6 +658,9 @@ protected:
 
     bool isDynamic = false;
 
+    // the node belongs to the shape computation lane, see Graph::MarkShapeComputationNodes
+    bool shapeComputationNode = false;
+
     bool isInputTensorAtPortEmpty(size_t port) const;
     bool isOutputTensorAtPortEmpty(size_t port) const;
 
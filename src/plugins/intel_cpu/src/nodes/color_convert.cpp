@@ -331,17 +331,21 @@ void RefConverter::convert(const T* y,
         auto y_ptr = y + batch * stride_y;
         auto uv_ptr = uv + batch * stride_uv;
 
-        for (int w = 0; w < width; w++) {
-            auto y_index = h * width + w;
-            auto y_val = static_cast<float>(y_ptr[y_index]);
-            auto uv_index = (h / 2) * width + (w / 2) * 2;
+        // chroma is horizontally subsampled, so each pair of pixels shares one UV sample
+        for (size_t w = 0; w < width; w += 2) {
+            auto uv_index = (h / 2) * width + w;
             auto u_val = static_cast<float>(uv_ptr[uv_index]);
             auto v_val = static_cast<float>(uv_ptr[uv_index + 1]);
-            T r, g, b;
-            std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
-            out[y_index * 3 + _colorFormat[0]] = r;
-            out[y_index * 3 + _colorFormat[1]] = g;
-            out[y_index * 3 + _colorFormat[2]] = b;
+            const size_t w_end = std::min(w + 2, width);
+            for (size_t p = w; p < w_end; p++) {
+                auto y_index = h * width + p;
+                auto y_val = static_cast<float>(y_ptr[y_index]);
+                T r, g, b;
+                std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+                out[y_index * 3 + _colorFormat[0]] = r;
+                out[y_index * 3 + _colorFormat[1]] = g;
+                out[y_index * 3 + _colorFormat[2]] = b;
+            }
         }
     });
 }
@@ -684,17 +688,21 @@ void RefConverter::convert(const T* y,
         auto u_ptr = u + batch * stride_uv;
         auto v_ptr = v + batch * stride_uv;
 
-        for (int w = 0; w < width; w++) {
-            auto y_index = h * width + w;
-            auto y_val = static_cast<float>(y_ptr[y_index]);
+        // chroma is horizontally subsampled, so each pair of pixels shares one UV sample
+        for (size_t w = 0; w < width; w += 2) {
             auto uv_index = (h / 2) * (width / 2) + w / 2;
             auto u_val = static_cast<float>(u_ptr[uv_index]);
             auto v_val = static_cast<float>(v_ptr[uv_index]);
-            T r, g, b;
-            std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
-            out[y_index * 3 + _colorFormat[0]] = r;
-            out[y_index * 3 + _colorFormat[1]] = g;
-            out[y_index * 3 + _colorFormat[2]] = b;
+            const size_t w_end = std::min(w + 2, width);
+            for (size_t p = w; p < w_end; p++) {
+                auto y_index = h * width + p;
+                auto y_val = static_cast<float>(y_ptr[y_index]);
+                T r, g, b;
+                std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+                out[y_index * 3 + _colorFormat[0]] = r;
+                out[y_index * 3 + _colorFormat[1]] = g;
+                out[y_index * 3 + _colorFormat[2]] = b;
+            }
         }
     });
 }
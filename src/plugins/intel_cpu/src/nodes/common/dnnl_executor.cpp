@@ -29,10 +29,26 @@ void DnnlExecutor::IntermReorder::exec(dnnl::memory& memSrc, dnnl::memory& memDs
 }
 
 void DnnlExecutor::exec(const std::unordered_map<int, dnnl::memory>& primArgs, dnnl::stream strm) {
-    if (inputReorders.empty() && outputReorders.empty()) {
-        execPrim.execute(strm, primArgs);
-    } else {
+    if (!inputReorders.empty() || !outputReorders.empty()) {
         reorder_exec(primArgs, strm);
+        return;
+    }
+    // Small shapes are dispatch bound, so the arguments go through a stack array and
+    // the C API: dnnl::primitive::execute allocates the same array on the heap per call.
+    constexpr size_t maxStackArgs = 32;
+    if (primArgs.size() <= maxStackArgs) {
+        dnnl_exec_arg_t args[maxStackArgs];
+        int argsCount = 0;
+        for (const auto& arg : primArgs) {
+            args[argsCount].arg = arg.first;
+            args[argsCount].memory = arg.second.get(true);
+            argsCount++;
+        }
+        auto status = dnnl_primitive_execute(execPrim.get(true), strm.get(true), argsCount, args);
+        if (status != dnnl_success)
+            IE_THROW() << "DnnlExecutor: primitive execution failed with status " << static_cast<int>(status);
+    } else {
+        execPrim.execute(strm, primArgs);
     }
 }
 
@@ -22,6 +22,7 @@
 #include "common/cpu_memcpy.h"
 #include "common/blocked_desc_creator.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
+#include "common/primitive_hashing_utils.hpp"
 using namespace dnnl;
 using namespace InferenceEngine;
 
@@ -30,6 +31,29 @@ namespace intel_cpu {
 namespace node {
 namespace {
     constexpr size_t channelAxis = 1lu;
+
+    struct ConcatKey {
+        std::vector<dnnl::memory::desc> srcs;
+        dnnl::memory::desc dst;
+        int axis;
+
+        size_t hash() const {
+            using namespace dnnl::impl;
+            using namespace dnnl::impl::primitive_hashing;
+
+            size_t seed = 0;
+            for (const auto& src : srcs) {
+                seed = hash_combine(seed, get_md_hash(*src.get()));
+            }
+            seed = hash_combine(seed, get_md_hash(*dst.get()));
+            seed = hash_combine(seed, axis);
+            return seed;
+        }
+
+        bool operator==(const ConcatKey& rhs) const {
+            return srcs == rhs.srcs && dst == rhs.dst && axis == rhs.axis;
+        }
+    };
 }
 
 bool Concat::isExecutable() const {
@@ -430,8 +454,15 @@ void Concat::prepareParams() {
             desc.get()->padded_dims[i] = dims[i];
         }
 
-        auto primitive_desc = concat::primitive_desc(getEngine(), desc, static_cast<int>(axis), srcs_d);
-        prim = concat(primitive_desc);
+        // a token-by-token growing sequence creates a new shape each step, keep the
+        // primitives in the runtime cache instead of rebuilding them every time
+        ConcatKey key = {std::move(srcs_d), desc, static_cast<int>(axis)};
+        auto& engine = getEngine();
+        auto builder = [&engine](const ConcatKey& key) -> dnnl::concat {
+            auto primitive_desc = concat::primitive_desc(engine, key.dst, key.axis, key.srcs);
+            return concat(primitive_desc);
+        };
+        prim = context->getParamsCache()->getOrCreate(key, builder).first;
 #ifdef CPU_DEBUG_CAPS
         if (prim) {
             auto pd = prim.get_primitive_desc();
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 
 #include <ngraph/op/ctc_loss.hpp>
@@ -85,7 +86,8 @@ void CTCLoss::execute(dnnl::stream strm) {
 
     std::vector<int> decodedTargetLenB(batchNum, 0);
     std::vector<std::vector<int>> targetDB(batchNum);
-    std::vector<std::vector<std::vector<float>>> logProbabilitiesB(batchNum);
+    // flat [actualLogitLen x decodedTargetLen] buffer per batch to avoid per-timestep allocations
+    std::vector<std::vector<float>> logProbabilitiesB(batchNum);
     std::vector<std::string> errorMsgB(parallel_get_max_threads());
 
     auto threadBody_1 = [&](const int ithr, const int nthr) {
@@ -146,11 +148,7 @@ void CTCLoss::execute(dnnl::stream strm) {
             }
             decodedTargetLenB[b] = decodedTargetLen;
 
-            auto& logProbabilities = logProbabilitiesB[b];
-            logProbabilities.resize(actualLogitLen);
-            for (size_t ll = 0; ll < actualLogitLen; ll++) {
-                logProbabilities[ll].resize(decodedTargetLen);
-            }
+            logProbabilitiesB[b].resize(actualLogitLen * decodedTargetLen);
         } // for batch
     }; // threadBody_1
 
@@ -196,13 +194,20 @@ void CTCLoss::execute(dnnl::stream strm) {
             double expSum = 0.0;
             size_t btcT = b * TC + sT * classesNum;
             // logProbabilities = logSoftmax = logits[b][t][c] - ln(sum_c(exp(logits[b][t])))
+            // computed as max-subtracted log-sum-exp to keep exp() in range for large logits
             for (size_t t = sT; t < actualLogitLen; t++) {
+                float maxLogit = logits[btcT];
+                for (size_t c = 1lu; c < classesNum; c++) {
+                    maxLogit = std::max(maxLogit, logits[btcT + c]);
+                }
                 expSum = 0.0;
                 for (size_t c = 0lu; c < classesNum; c++) {
-                    expSum += std::exp(logits[btcT + c]);
+                    expSum += std::exp(logits[btcT + c] - maxLogit);
                 }
+                const float logSum = maxLogit + static_cast<float>(std::log(expSum));
+                float* logProbT = &logProbabilities[t * decodedTargetLen];
                 for (size_t s = 0lu; s < decodedTargetLen; s++) {
-                    logProbabilities[t][s] = logits[btcT + targetD[s]] - std::log(expSum);
+                    logProbT[s] = logits[btcT + targetD[s]] - logSum;
                 }
                 btcT += classesNum;
                 if (++workCounter >= end) {
@@ -243,37 +248,41 @@ void CTCLoss::execute(dnnl::stream strm) {
             auto& logProbabilities = logProbabilitiesB[b];
             const int actualLogitLen = logitsLength[b];
             const int decodedTargetLen = decodedTargetLenB[b];
-            std::vector<std::vector<float>> logBwd(decodedTargetLen, std::vector<float>(actualLogitLen, -float_inf));
+            // flat [decodedTargetLen x actualLogitLen] buffer, single allocation per batch
+            std::vector<float> logBwd(decodedTargetLen * actualLogitLen, -float_inf);
             for (int s = decodedTargetLen - 2; s < decodedTargetLen; s++)
-                logBwd[s][actualLogitLen - 1] = 0.f;
+                logBwd[s * actualLogitLen + actualLogitLen - 1] = 0.f;
 
             for (int t = actualLogitLen - 2; t >= 0; t--) {
                 const int t_1 = t + 1;
+                const float* logProbT1 = &logProbabilities[t_1 * decodedTargetLen];
                 for (int s = std::max(0, decodedTargetLen - (2 * (actualLogitLen - t)));
                      s < std::min(decodedTargetLen, 2 * (t_1)); s++) {
+                    float logVal = logBwd[s * actualLogitLen + t];
                     if (ctcMergeRepeated || targetD[s] == blankIndex) {
-                        logBwd[s][t] = sumLogs(logBwd[s][t],
-                                               logBwd[s][t_1] + logProbabilities[t_1][s]);
+                        logVal = sumLogs(logVal,
+                                         logBwd[s * actualLogitLen + t_1] + logProbT1[s]);
                     }
 
                     if (s + 1 < decodedTargetLen) {
-                        logBwd[s][t] = sumLogs(logBwd[s][t],
-                                               logBwd[s + 1][t_1] + logProbabilities[t_1][s + 1]);
+                        logVal = sumLogs(logVal,
+                                         logBwd[(s + 1) * actualLogitLen + t_1] + logProbT1[s + 1]);
                     }
 
                     if (s + 2 < decodedTargetLen) {
                         if (targetD[s] != blankIndex && (!ctcMergeRepeated || (targetD[s] != targetD[s + 2]))) {
-                            logBwd[s][t] = sumLogs(logBwd[s][t],
-                                                   logBwd[s + 2][t_1] + logProbabilities[t_1][s + 2]);
+                            logVal = sumLogs(logVal,
+                                             logBwd[(s + 2) * actualLogitLen + t_1] + logProbT1[s + 2]);
                         }
                     }
+                    logBwd[s * actualLogitLen + t] = logVal;
                 }
             }
 
-            logBwd[0][0] += logProbabilities[0][0];
-            logBwd[1][0] += logProbabilities[0][(decodedTargetLen > 1) ? 1 : 0];
+            logBwd[0] += logProbabilities[0];
+            logBwd[actualLogitLen] += logProbabilities[(decodedTargetLen > 1) ? 1 : 0];
 
-            dstData[b] = -sumLogs(logBwd[0][0], logBwd[1][0]);
+            dstData[b] = -sumLogs(logBwd[0], logBwd[actualLogitLen]);
         } // for batch
     }; // threadBody_3
 
@@ -248,11 +248,20 @@ void DFT::execute(dnnl::stream strm) {
     const auto& outputStrides = outputDataEdge->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
 
     size_t nComplexMaxFFT = 0;
+    std::vector<size_t> staleBluesteinLengths;
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
         // FFT uses different twiddle factors
         if (!IsPowerOfTwo(nComplex)) {
-            if (twiddlesMapDFT.find(nComplex) == twiddlesMapDFT.end() || lastInverse != inverse) {
+            if (useBluestein(nComplex)) {
+                // the convolution FFTs run on the padded power-of-two length
+                if (nComplexMaxFFT < bluesteinLength(nComplex)) {
+                    nComplexMaxFFT = bluesteinLength(nComplex);
+                }
+                if (chirpMapDFT.find(nComplex) == chirpMapDFT.end() || lastInverse != inverse) {
+                    staleBluesteinLengths.push_back(nComplex);
+                }
+            } else if (twiddlesMapDFT.find(nComplex) == twiddlesMapDFT.end() || lastInverse != inverse) {
                 twiddlesMapDFT[nComplex] = generateTwiddlesDFT(nComplex, inverse);
             }
         } else {
@@ -266,6 +275,11 @@ void DFT::execute(dnnl::stream strm) {
         updateTwiddlesFFT(nComplexMaxFFT, inverse);
     }
 
+    // chirp spectra are produced with the FFT twiddles above, so they are refreshed after them
+    for (size_t staleLength : staleBluesteinLengths) {
+        updateBluesteinBuffers(staleLength, inverse);
+    }
+
     if (inputShape != outputShape) {
         copyDataToOutputWithSignalSize(src, inputShape, inputStrides, dst, outputShape, outputStrides);
     } else {
@@ -285,6 +299,8 @@ void DFT::execute(dnnl::stream strm) {
             if (resultBufPtr != dst) {
                 cpu_memcpy(dst, resultBufPtr, nComplex * 2 * sizeof(float));
             }
+        } else if (useBluestein(nComplex)) {
+            bluesteinDFT(dst, nComplex * 2, inverse, true);
         } else {
             naiveDFT(dst, nComplex * 2, inverse);
         }
@@ -324,9 +340,14 @@ void DFT::dftNd(float* output,
             } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
         } else {
             std::vector<float> gatheredData(outputLen);
+            const bool bluestein = useBluestein(outputComplexLen);
             do {
                 gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen, inverse);
+                if (bluestein) {
+                    bluesteinDFT(gatheredData.data(), outputLen, inverse, true);
+                } else {
+                    naiveDFT(gatheredData.data(), outputLen, inverse);
+                }
                 applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
             } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
         }
@@ -466,6 +487,99 @@ void DFT::naiveDFT(float* data, size_t dataLength, bool inverse) const {
     cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
 }
 
+size_t DFT::bluesteinLength(size_t n_complex) {
+    size_t length = 1;
+    while (length < 2 * n_complex - 1) {
+        length *= 2;
+    }
+    return length;
+}
+
+bool DFT::useBluestein(size_t n_complex) {
+    // the naive transform wins on short signals, the three convolution FFTs
+    // only pay off once the quadratic term dominates
+    return n_complex > 64;
+}
+
+/* Bluestein's algorithm: an arbitrary-length DFT expressed as a circular convolution with a
+ * chirp sequence, evaluated with power-of-two FFTs of the padded length. Turns the O(n^2)
+ * fallback into O(n*log(n)) for non-power-of-two signal sizes. */
+void DFT::bluesteinDFT(float* data, size_t dataLength, bool inverse, bool parallelize) const {
+    const size_t nComplex = dataLength / 2;
+    const size_t fftLength = bluesteinLength(nComplex);
+    const auto& chirp = chirpMapDFT.find(nComplex)->second;
+    const auto& chirpFFT = chirpFFTMapDFT.find(nComplex)->second;
+
+    std::vector<float> buffers(fftLength * 4, 0.0f);
+    float* inBuffer = buffers.data();
+    float* outBuffer = buffers.data() + fftLength * 2;
+
+    // modulate the signal with the chirp and zero-pad to the convolution length
+    for (size_t k = 0; k < nComplex; k++) {
+        inBuffer[2 * k] = getRealFromComplexProd(data[2 * k], data[2 * k + 1], chirp[2 * k], chirp[2 * k + 1]);
+        inBuffer[2 * k + 1] = getImaginaryFromComplexProd(data[2 * k], data[2 * k + 1], chirp[2 * k], chirp[2 * k + 1]);
+    }
+
+    const float* signalSpectrum;
+    fft(inBuffer, outBuffer, fftLength * 2, false, parallelize, &signalSpectrum);
+
+    // pointwise product with the cached chirp spectrum, conjugated so the second forward FFT
+    // acts as the inverse transform of the convolution
+    float* productBuffer = signalSpectrum == inBuffer ? outBuffer : inBuffer;
+    float* scratchBuffer = signalSpectrum == inBuffer ? inBuffer : outBuffer;
+    for (size_t k = 0; k < fftLength; k++) {
+        productBuffer[2 * k] = getRealFromComplexProd(signalSpectrum[2 * k], signalSpectrum[2 * k + 1],
+                                                      chirpFFT[2 * k], chirpFFT[2 * k + 1]);
+        productBuffer[2 * k + 1] = -getImaginaryFromComplexProd(signalSpectrum[2 * k], signalSpectrum[2 * k + 1],
+                                                                chirpFFT[2 * k], chirpFFT[2 * k + 1]);
+    }
+
+    const float* convolution;
+    fft(productBuffer, scratchBuffer, fftLength * 2, false, parallelize, &convolution);
+
+    // demodulate with the chirp again; 1/fftLength undoes the unscaled convolution FFTs and
+    // the inverse transform carries the usual extra 1/nComplex
+    const float scale = inverse ? 1.0f / (static_cast<float>(fftLength) * nComplex)
+                                : 1.0f / static_cast<float>(fftLength);
+    for (size_t k = 0; k < nComplex; k++) {
+        const float convReal = convolution[2 * k];
+        const float convImag = -convolution[2 * k + 1];
+        data[2 * k] = getRealFromComplexProd(convReal, convImag, chirp[2 * k], chirp[2 * k + 1]) * scale;
+        data[2 * k + 1] = getImaginaryFromComplexProd(convReal, convImag, chirp[2 * k], chirp[2 * k + 1]) * scale;
+    }
+}
+
+void DFT::updateBluesteinBuffers(size_t n_complex, bool inverse) {
+    const float inverseMultiplier = inverse ? 1 : -1;
+    const size_t fftLength = bluesteinLength(n_complex);
+
+    // chirp[k] = exp(direction * i * pi * k^2 / n), the quadratic phase of the Bluestein identity
+    std::vector<float> chirp(n_complex * 2);
+    for (size_t k = 0; k < n_complex; k++) {
+        // reduce k^2 modulo 2n before the float conversion to keep the phase accurate for large k
+        const size_t k2 = (k * k) % (2 * n_complex);
+        const float phase = PI * static_cast<float>(k2) / static_cast<float>(n_complex);
+        chirp[2 * k] = std::cos(phase);
+        chirp[2 * k + 1] = std::sin(phase) * inverseMultiplier;
+    }
+
+    // the fixed convolution operand: FFT of the circularly padded conjugate chirp
+    std::vector<float> padded(fftLength * 2, 0.0f);
+    padded[0] = chirp[0];
+    padded[1] = -chirp[1];
+    for (size_t k = 1; k < n_complex; k++) {
+        padded[2 * k] = padded[2 * (fftLength - k)] = chirp[2 * k];
+        padded[2 * k + 1] = padded[2 * (fftLength - k) + 1] = -chirp[2 * k + 1];
+    }
+
+    std::vector<float> workBuffer(fftLength * 2);
+    const float* resultBufPtr;
+    fft(padded.data(), workBuffer.data(), fftLength * 2, false, true, &resultBufPtr);
+
+    chirpFFTMapDFT[n_complex] = std::vector<float>(resultBufPtr, resultBufPtr + fftLength * 2);
+    chirpMapDFT[n_complex] = std::move(chirp);
+}
+
 std::vector<float> DFT::generateTwiddlesDFT(size_t n_complex, bool inverse) const {
     std::vector<float> twiddles(n_complex * n_complex * 2);
     const float inverseMultiplier = inverse ? 1 : -1;
@@ -530,7 +644,12 @@ void DFT::prepareParams() {
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
         if (!IsPowerOfTwo(nComplex)) {
-            hasDFT = true;
+            if (useBluestein(nComplex)) {
+                // Bluestein evaluates the transform with power-of-two FFTs
+                hasFFT = true;
+            } else {
+                hasDFT = true;
+            }
         } else {
             hasFFT = true;
         }
@@ -44,15 +44,21 @@ private:
              bool parallelize,
              const float** resultBuf) const;
     void naiveDFT(float* data, size_t dataLength, bool inverse) const;
+    void bluesteinDFT(float* data, size_t dataLength, bool inverse, bool parallelize) const;
 
     std::vector<float> generateTwiddlesDFT(size_t n_complex, bool inverse) const;
     void updateTwiddlesFFT(size_t n_complex, bool inverse);
+    void updateBluesteinBuffers(size_t n_complex, bool inverse);
+    static size_t bluesteinLength(size_t n_complex);
+    static bool useBluestein(size_t n_complex);
 
     std::unique_ptr<jit_uni_dft_kernel> dftKernel = nullptr;
     std::unique_ptr<jit_uni_fft_kernel> fftKernel = nullptr;
 
     std::vector<float> twiddlesFFT;
     std::unordered_map<size_t, std::vector<float>> twiddlesMapDFT;
+    std::unordered_map<size_t, std::vector<float>> chirpMapDFT;
+    std::unordered_map<size_t, std::vector<float>> chirpFFTMapDFT;
 
     std::vector<int32_t> axes;
     std::vector<size_t> inputShape;
@@ -17,6 +17,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "ie_parallel.hpp"
 
 #include "onednn/dnnl.h"
 #include "oneapi/dnnl/dnnl.hpp"
@@ -274,6 +275,17 @@ void FullyConnected::createPrimitive() {
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     Node::createPrimitive();
     appendPostOpArgs(attr, primArgs, postOpsArgs);
+
+    // for dynamic shapes prepareParams is deferred to the first request, so pre-pack
+    // the weights for the layout selected at compile time to keep the reorder stall
+    // out of the inference path; prepareParams picks the blob up from the weights
+    // cache whenever the runtime chosen layout matches
+    if (isDynamicNode() && !useSparseWeights && weightDescIP &&
+        getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant()) {
+        const auto weightDesc = MemoryDescUtils::convertToDnnlMemoryDesc(weightDescIP);
+        if (weightDesc->isDefined())
+            prepareWeightMemory(weightDesc);
+    }
 }
 
 void FullyConnected::prepareParams() {
@@ -885,12 +897,19 @@ bool FullyConnected::useSparseWeightsDecompression() {
 
     auto weightsData = reinterpret_cast<const int8_t*>(blb->GetPtr());
     auto elementsCount = blb->GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
+    // the scan walks the whole blob at compile time, so count the zeros in parallel
+    static const size_t blockSize = 2048;
+    const size_t blocksNum = (elementsCount + blockSize - 1) / blockSize;
     size_t zerosCounts = 0;
-    for (int i = 0; i < elementsCount; i++) {
-        if (weightsData[i] == 0) {
-            zerosCounts++;
+    zerosCounts = parallel_sum(blocksNum, zerosCounts, [&](size_t b) -> size_t {
+        size_t count = 0;
+        const size_t end = std::min((b + 1) * blockSize, static_cast<size_t>(elementsCount));
+        for (size_t i = b * blockSize; i < end; i++) {
+            if (weightsData[i] == 0)
+                count++;
         }
-    }
+        return count;
+    });
 
     DEBUG_LOG(getName(), ", elementsCount = ", elementsCount, ", zerosCounts = ",
         zerosCounts, ", nnzCount = ", elementsCount - zerosCounts);
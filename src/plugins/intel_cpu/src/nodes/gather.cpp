@@ -10,6 +10,9 @@
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
 #include <utils/general_utils.h>
+#if defined(OPENVINO_ARCH_X86_64)
+#include <immintrin.h>
+#endif
 #include "kernels/x64/gather_uni_kernel.hpp"
 #include "utils/shape_inference/shape_inference_cpu.hpp"
 
@@ -525,6 +528,12 @@ void Gather::execReference() {
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
+    // embedding table lookup collapses into one row copy per index
+    if (beforeBatchSize == 1lu && betweenBatchAndAxisSize == 1lu && afterAxisSize > 1lu) {
+        execRowGather(srcIndices, srcData, dstData);
+        return;
+    }
+
     const size_t dstAfterBatchSize = betweenBatchAndAxisSize * specIdxAndAfterAxSizeB;
     parallel_for2d(beforeBatchSize, specIndicesSize, [&](const size_t b, const size_t j) {
         int ii = srcIndices[b * specIndicesSize + j];
@@ -552,6 +561,50 @@ void Gather::execReference() {
     });
 }
 
+void Gather::execRowGather(const int32_t* srcIndices, const uint8_t* srcData, uint8_t* dstData) {
+    // Large tables don't fit in cache and the lookups are latency bound, so the rows
+    // the thread is about to read are prefetched a fixed distance ahead. Runs of
+    // consecutive indices (frequent after indices sorting) are merged into one copy.
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        uint64_t start = 0lu, end = 0lu;
+        splitter(specIndicesSize, nthr, ithr, start, end);
+        for (uint64_t j = start; j < end;) {
+            int64_t idx = srcIndices[j];
+            if (idx < 0)
+                idx = reverseIndexing ? idx + axisDim : axisDim;
+
+            uint64_t run = 1lu;
+            if (static_cast<uint64_t>(idx) < axisDim) {
+                while (j + run < end && static_cast<uint64_t>(idx) + run < axisDim &&
+                        srcIndices[j + run] == idx + static_cast<int64_t>(run))
+                    run++;
+            }
+
+#if defined(OPENVINO_ARCH_X86_64)
+            if (j + run < end) {
+                constexpr uint64_t prefetchDistance = 8lu;
+                const int64_t nextIdx = srcIndices[std::min(j + run + prefetchDistance, end - 1lu)];
+                if (nextIdx >= 0 && static_cast<uint64_t>(nextIdx) < axisDim) {
+                    const char* row = reinterpret_cast<const char*>(srcData) + afterAxisSizeInBytes * nextIdx;
+                    _mm_prefetch(row, _MM_HINT_T0);
+                    if (afterAxisSizeInBytes > 64lu)
+                        _mm_prefetch(row + 64, _MM_HINT_T0);
+                }
+            }
+#endif
+
+            if (static_cast<uint64_t>(idx) < axisDim) {
+                cpu_memcpy(dstData + afterAxisSizeInBytes * j,
+                           srcData + afterAxisSizeInBytes * idx,
+                           afterAxisSizeInBytes * run);
+            } else {
+                memset(dstData + afterAxisSizeInBytes * j, 0, afterAxisSizeInBytes);
+            }
+            j += run;
+        }
+    });
+}
+
 bool Gather::created() const {
     return getType() == Type::Gather;
 }
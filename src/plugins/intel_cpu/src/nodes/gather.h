@@ -53,6 +53,7 @@ protected:
 private:
     void initShortParams(threadExecParams& p, uint64_t start);
     void execReference();
+    void execRowGather(const int32_t* srcIndices, const uint8_t* srcData, uint8_t* dstData);
 
     bool isDataShapeStat = false;
     bool isIdxShapeStat = false;
@@ -8,6 +8,7 @@
 #include "ie_ngraph_utils.hpp"
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
+#include <utils/debug_capabilities.h>
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
 #include <string>
@@ -69,61 +70,6 @@ If::If(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context) :
 void If::getSupportedDescriptors() {
     auto ifOp = ov::as_type_ptr<ov::op::v8::If>(ovOp);
 
-    const std::shared_ptr<const ov::Model>& thenBody = ifOp->get_then_body();
-    const std::shared_ptr<const ov::Model>& elseBody = ifOp->get_else_body();
-    subGraphThen.CreateGraph(thenBody, context);
-    subGraphElse.CreateGraph(elseBody, context);
-
-    const auto &inMapThen = subGraphThen.GetInputNodesMap();
-    for (const auto &param : ifOp->get_then_body()->get_parameters()) {
-        auto inNode = inMapThen.find(param->get_friendly_name());
-        if (inNode != inMapThen.end()) {
-            inputMemThen.push_back(getToMemories(inNode->second.get(), 0));
-        } else {
-            IE_THROW() << "Then body of node If with name " << getName() << " does not have input with name: "
-                    << param->get_friendly_name();
-        }
-    }
-
-    const auto &inMapElse = subGraphElse.GetInputNodesMap();
-    for (const auto &param : ifOp->get_else_body()->get_parameters()) {
-        auto inNode = inMapElse.find(param->get_friendly_name());
-        if (inNode != inMapElse.end()) {
-            inputMemElse.push_back(getToMemories(inNode->second.get(), 0));
-        } else {
-            IE_THROW() << "Else body of node If with name " << getName() << " does not have input with name: "
-                    << param->get_friendly_name();
-        }
-    }
-
-    const auto &outMapThen = subGraphThen.GetOutputNodesMap();
-    for (const auto& out : ifOp->get_then_body()->get_results()) {
-        const auto prev = out->input_value(0);
-        const std::string inputID = ov::op::util::get_ie_output_name(prev);
-        auto outNode = outMapThen.find(inputID);
-        if (outNode != outMapThen.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            outputMemThen.push_back(outMem);
-        } else {
-            IE_THROW() << "Then body of node If with name " << getName() << " does not have output with name: "
-                    << inputID;
-        }
-    }
-
-    const auto &outMapElse = subGraphElse.GetOutputNodesMap();
-    for (const auto& out : ifOp->get_else_body()->get_results()) {
-        const auto prev = out->input_value(0);
-        const std::string inputID = ov::op::util::get_ie_output_name(prev);
-        auto outNode = outMapElse.find(inputID);
-        if (outNode != outMapElse.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            outputMemElse.push_back(outMem);
-        } else {
-            IE_THROW() << "Else body of node If with name " << getName() << " does not have output with name: "
-                    << inputID;
-        }
-    }
-
     // Port map: outputs
     for (const auto& desc : ifOp->get_output_descriptions(0)) {
         auto body_output_idx = desc->m_body_value_index;
@@ -174,17 +120,55 @@ void If::initSupportedPrimitiveDescriptors() {
 }
 
 void If::createPrimitive() {
-    const auto& eng = getEngine();
-    prepareBeforeMappers(true, eng);
-    prepareBeforeMappers(false, eng);
-    prepareAfterMappers(true, eng);
-    prepareAfterMappers(false, eng);
-
+    // Bodies are not compiled here: each one is prepared by prepareBody() when its branch is
+    // taken for the first time, so a branch that is never taken (an early-exit head of a
+    // cascade model) costs neither compile time nor primitive memory.
     if (inputShapesDefined()) {
         updateLastInputDims();
     }
 }
 
+void If::prepareBody(const bool isThen) {
+    auto ifOp = ov::as_type_ptr<ov::op::v8::If>(ovOp);
+
+    auto& subGraph = isThen ? subGraphThen : subGraphElse;
+    auto& inputMems = isThen ? inputMemThen : inputMemElse;
+    auto& outputMems = isThen ? outputMemThen : outputMemElse;
+    const auto& body = isThen ? ifOp->get_then_body() : ifOp->get_else_body();
+    const char* bodyName = isThen ? "Then" : "Else";
+
+    subGraph.CreateGraph(body, context);
+
+    const auto &inMap = subGraph.GetInputNodesMap();
+    for (const auto &param : body->get_parameters()) {
+        auto inNode = inMap.find(param->get_friendly_name());
+        if (inNode != inMap.end()) {
+            inputMems.push_back(getToMemories(inNode->second.get(), 0));
+        } else {
+            IE_THROW() << bodyName << " body of node If with name " << getName() << " does not have input with name: "
+                    << param->get_friendly_name();
+        }
+    }
+
+    const auto &outMap = subGraph.GetOutputNodesMap();
+    for (const auto& out : body->get_results()) {
+        const auto prev = out->input_value(0);
+        const std::string inputID = ov::op::util::get_ie_output_name(prev);
+        auto outNode = outMap.find(inputID);
+        if (outNode != outMap.end()) {
+            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
+            outputMems.push_back(outMem);
+        } else {
+            IE_THROW() << bodyName << " body of node If with name " << getName() << " does not have output with name: "
+                    << inputID;
+        }
+    }
+
+    const auto& eng = getEngine();
+    prepareBeforeMappers(isThen, eng);
+    prepareAfterMappers(isThen, eng);
+}
+
 void If::prepareBeforeMappers(const bool isThen, const dnnl::engine& eng) {
     auto &inputPortMap = isThen ? thenInputPortMap : elseInputPortMap;
     auto &inputMems = isThen ? inputMemThen : inputMemElse;
@@ -219,6 +203,16 @@ std::deque<MemoryPtr> If::getToMemories(const Node* node, const size_t port) con
 void If::execute(dnnl::stream strm) {
     const bool condition = static_cast<const bool>((reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()))[0]);
 
+    auto& bodyPrepared = condition ? thenBodyPrepared : elseBodyPrepared;
+    if (!bodyPrepared) {
+        prepareBody(condition);
+        bodyPrepared = true;
+    }
+    auto& execCount = condition ? thenExecCount : elseExecCount;
+    execCount++;
+    DEBUG_LOG(getName(), " takes the ", condition ? "then" : "else",
+              " branch (then/else taken ", thenExecCount, "/", elseExecCount, " times)");
+
     auto& beforeMappers = condition ? beforeThenMappers : beforeElseMappers;
     auto& afterMappers = condition ? afterThenMappers : afterElseMappers;
     auto& subGraph = condition ? subGraphThen : subGraphElse;
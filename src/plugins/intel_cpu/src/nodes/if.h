@@ -33,6 +33,7 @@ protected:
     bool needShapeInfer() const override { return false; }
 
 private:
+    void prepareBody(const bool isThen);
     void prepareBeforeMappers(const bool isThen, const dnnl::engine& eng);
     void prepareAfterMappers(const bool isThen, const dnnl::engine& eng);
 
@@ -76,6 +77,15 @@ private:
         elseInputPortMap,
         elseOutputPortMap;
 
+    // bodies are compiled lazily when their branch is first taken, so a cold branch
+    // costs neither compile time nor primitive memory
+    bool thenBodyPrepared = false;
+    bool elseBodyPrepared = false;
+
+    // branch taken counters for profiling purposes
+    size_t thenExecCount = 0;
+    size_t elseExecCount = 0;
+
     const std::shared_ptr<ov::Node> ovOp;
 };
 
@@ -16,6 +16,7 @@
 #include <ie_ngraph_utils.hpp>
 #include <blob_factory.hpp>
 #include "caseless.hpp"
+#include "weights_cache.hpp"
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
 #include "utils/cpu_utils.hpp"
@@ -356,6 +357,18 @@ void Input::cloneBlobIfRequired() {
     };
 
     auto blobKey = [&, this] () {
+        // With the process-shared cache the key is built from the blob content: node names
+        // and data pointers are model-local, while layers identical across compiled models
+        // (e.g. precision variants of one base model) should be mapped into memory only once.
+        if (context->getConfig().sharedWeightsCache) {
+            const uint64_t data_hash = WeightsSharing::GetHashFunc().hash(
+                    reinterpret_cast<const unsigned char*>(constOp->get_data_ptr()), constOp->get_byte_size());
+            return std::string("shared_const")
+                    + "_" + std::string(prec.name())
+                    + "_" + shape.toString()
+                    + "_" + std::to_string(needFlushDenormalsToZero)
+                    + "_" + std::to_string(data_hash);
+        }
         char ptr[32];
         snprintf(ptr, sizeof ptr, "%p", constOp->get_data_ptr());
         return getName()
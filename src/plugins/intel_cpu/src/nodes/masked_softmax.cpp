@@ -0,0 +1,170 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ie_parallel.hpp"
+#include "masked_softmax.h"
+#include "transformations/cpu_opset/x64/op/masked_softmax.hpp"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool MaskedSoftmax::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto maskedSoftmax = std::dynamic_pointer_cast<const MaskedSoftmaxNode>(op);
+        if (!maskedSoftmax) {
+            errorMessage = "Only MaskedSoftmax from CPU internal opset is supported.";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MaskedSoftmax::MaskedSoftmax(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "MaskedSoftmax layer with name '" + op->get_friendly_name() + "' ";
+    if (getOriginalInputsNumber() != 2)
+        IE_THROW() << errorPrefix << "has invalid number of input edges: " << getOriginalInputsNumber();
+    if (getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << "has invalid number of outputs edges: " << getOriginalOutputsNumber();
+}
+
+void MaskedSoftmax::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    dataPrecision = getOriginalInputPrecisionAtPort(DATA_INDEX);
+    if (dataPrecision != Precision::FP32 && dataPrecision != Precision::BF16)
+        dataPrecision = Precision::FP32;
+
+    // the kernel always reads the mask as float
+    addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
+                          {LayoutType::ncsp, Precision::FP32}},
+                         {{LayoutType::ncsp, dataPrecision}},
+                         impl_desc_type::ref_any);
+}
+
+void MaskedSoftmax::prepareParams() {
+    const auto& dims = getParentEdgeAt(DATA_INDEX)->getMemory().getStaticDims();
+    const size_t workAmount = dims.back();
+
+    if (softmaxKernel && kernelWorkAmount == workAmount)
+        return;
+
+    jit_mul_add_softmax_compile_params jcp;
+    jcp.src_prc = dataPrecision;
+    jcp.dst_prc = dataPrecision;
+    jcp.work_amount = workAmount;
+    jcp.with_mul_scales = false;
+    jcp.is_mul_first = false;
+    jcp.with_scales0 = false;
+    jcp.broadcast_scales0 = false;
+    jcp.with_scales1 = false;
+    jcp.broadcast_scales1 = false;
+
+    softmaxKernel = createMulAddSoftmaxKernel(jcp);
+    if (softmaxKernel) {
+        softmaxKernel->create_ker();
+    } else if (dataPrecision != Precision::FP32) {
+        // the scalar fallback handles float only
+        IE_THROW() << errorPrefix << "cannot create jit kernel for " << dataPrecision << " precision";
+    }
+    kernelWorkAmount = workAmount;
+}
+
+void MaskedSoftmax::execute(dnnl::stream strm) {
+    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(DATA_INDEX)->getMemoryPtr()->GetPtr());
+    const float* maskData = reinterpret_cast<const float*>(getParentEdgeAt(MASK_INDEX)->getMemoryPtr()->GetPtr());
+    uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr());
+
+    const auto& dims = getParentEdgeAt(DATA_INDEX)->getMemory().getStaticDims();
+    const auto& maskDims = getParentEdgeAt(MASK_INDEX)->getMemory().getStaticDims();
+    const size_t rank = dims.size();
+    const size_t axisDim = dims[rank - 1];
+
+    size_t rows = 1lu;
+    for (size_t i = 0; i < rank - 1; i++)
+        rows *= dims[i];
+    if (rows == 0lu || axisDim == 0lu)
+        return;
+
+    // dense strides of the mask with broadcast dimensions zeroed out
+    std::vector<size_t> maskStrides(rank, 0lu);
+    size_t stride = 1lu;
+    for (size_t i = rank; i > 0lu; i--) {
+        maskStrides[i - 1] = maskDims[i - 1] == 1lu ? 0lu : stride;
+        stride *= maskDims[i - 1];
+    }
+
+    const size_t dataSize = dataPrecision.size();
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(rows, nthr, ithr, start, end);
+        if (start == end)
+            return;
+
+        std::vector<float> buffer(softmaxKernel ? axisDim : 0lu);
+        for (size_t row = start; row < end; row++) {
+            size_t maskOffset = 0lu;
+            size_t tmp = row;
+            for (size_t i = rank - 1; i > 0lu; i--) {
+                maskOffset += (tmp % dims[i - 1]) * maskStrides[i - 1];
+                tmp /= dims[i - 1];
+            }
+
+            const float* maskRow = maskData + maskOffset;
+            if (softmaxKernel) {
+                jit_mul_add_softmax_call_args call_args;
+                call_args.p_in0 = srcData + row * axisDim * dataSize;
+                call_args.p_mul_in1 = nullptr;
+                call_args.p_add_in1 = maskRow;
+                call_args.p_out = dstData + row * axisDim * dataSize;
+                call_args.p_buffer = buffer.data();
+                call_args.p_scales0 = nullptr;
+                call_args.p_scales1 = nullptr;
+                (*softmaxKernel)(&call_args);
+            } else {
+                const float* srcRow = reinterpret_cast<const float*>(srcData) + row * axisDim;
+                float* dstRow = reinterpret_cast<float*>(dstData) + row * axisDim;
+                float max = srcRow[0] + maskRow[0];
+                for (size_t i = 1lu; i < axisDim; i++)
+                    max = std::max(max, srcRow[i] + maskRow[i]);
+                float sum = 0.f;
+                for (size_t i = 0lu; i < axisDim; i++) {
+                    dstRow[i] = std::exp(srcRow[i] + maskRow[i] - max);
+                    sum += dstRow[i];
+                }
+                const float scale = 1.f / sum;
+                for (size_t i = 0lu; i < axisDim; i++)
+                    dstRow[i] *= scale;
+            }
+        }
+    });
+}
+
+void MaskedSoftmax::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool MaskedSoftmax::created() const {
+    return getType() == Type::MaskedSoftmax;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
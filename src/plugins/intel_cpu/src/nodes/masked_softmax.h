@@ -0,0 +1,44 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <memory>
+#include <string>
+
+#include "mha.h"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class MaskedSoftmax : public Node {
+public:
+    MaskedSoftmax(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    void prepareParams() override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    const size_t DATA_INDEX = 0lu;
+    const size_t MASK_INDEX = 1lu;
+
+    InferenceEngine::Precision dataPrecision = InferenceEngine::Precision::FP32;
+    std::unique_ptr<jit_uni_mul_add_softmax_kernel> softmaxKernel;
+    size_t kernelWorkAmount = 0lu;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
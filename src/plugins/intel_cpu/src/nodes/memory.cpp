@@ -119,7 +119,29 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    auto& edgeMem = getChildEdgeAt(0)->getMemory();
+
+    // When no consumer overwrites the output tensor in place and the tensor does not leave
+    // the graph directly, the state store aliases the edge memory (the graph pins such
+    // tensors out of the reuse workspace, see Graph::AllocateWithReuse): the per-infer
+    // store-to-edge copy disappears, Assign writes land exactly where ReadValue is read,
+    // and SetState swaps (e.g. per-request adapter weights) become a single copy into place.
+    aliasEdgeMemory = true;
+    for (auto& childEdge : getChildEdges()) {
+        auto edgePtr = childEdge.lock();
+        if (!edgePtr)
+            continue;
+        if (edgePtr->inPlace(Edge::LOOK_DOWN) || edgePtr->getChild()->getType() == Type::Output) {
+            aliasEdgeMemory = false;
+            break;
+        }
+    }
+
+    if (aliasEdgeMemory) {
+        dataStore->Create(edgeMem.getDesc(), edgeMem.GetData(), false);
+    } else {
+        dataStore->Create(edgeMem.getDesc());
+    }
 
     // default memory state is zero filled
     if (dataStore->getDesc().hasDefinedMaxSize())
@@ -165,6 +187,10 @@ void MemoryInput::storeState(const Memory &new_state) {
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    // when the store aliases the output edge memory the state is already in place
+    if (aliasEdgeMemory)
+        return;
+
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
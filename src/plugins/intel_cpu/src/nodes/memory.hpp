@@ -105,6 +105,8 @@ public:
     MemoryPtr getStore();
  private:
     MemoryPtr dataStore;
+    // the store aliases the output edge memory, see createPrimitive
+    bool aliasEdgeMemory = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -16,6 +16,7 @@
 #include "common/cpu_convert.h"
 #include "transformations/cpu_opset/x64/op/mha.hpp"
 #include "dnnl_extension_utils.h"
+#include "onednn/dnnl.h"
 #include <ie_ngraph_utils.hpp>
 
 using namespace InferenceEngine;
@@ -667,6 +668,20 @@ private:
 
 #endif // OPENVINO_ARCH_X86_64
 
+std::unique_ptr<jit_uni_mul_add_softmax_kernel> createMulAddSoftmaxKernel(const jit_mul_add_softmax_compile_params& jcp) {
+    std::unique_ptr<jit_uni_mul_add_softmax_kernel> kernel;
+#if defined(OPENVINO_ARCH_X86_64)
+    if (mayiuse(cpu_isa_t::avx512_core)) {
+        kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx512_core>(jcp));
+    } else if (mayiuse(cpu_isa_t::avx2)) {
+        kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx2>(jcp));
+    } else if (mayiuse(cpu_isa_t::sse41)) {
+        kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::sse41>(jcp));
+    }
+#endif // OPENVINO_ARCH_X86_64
+    return kernel;
+}
+
 bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto mha = std::dynamic_pointer_cast<const MHANode>(op);
@@ -928,6 +943,16 @@ void MHA::prepareParams() {
     size_t numThreads = parallel_get_max_threads();
 
     size_t matmulOptimalM = 32;
+    // The kernels already walk the scores tile by tile, so the full S x S matrix is never
+    // materialized. Still, for long sequences the fp32 score accumulator tile
+    // (M_blk x seq_len) outgrows the per-core L2 and every softmax pass re-reads it from L3.
+    // Halve the tile height until the accumulator takes at most half of L2, leaving the rest
+    // of the cache to the value rows streamed by the second matmul.
+    const size_t l2CacheSize = dnnl::utils::get_cache_size(2, true);
+    if (l2CacheSize) {
+        while (matmulOptimalM > 8 && matmulOptimalM * dimsMatMul0In1[3] * sizeof(float) > l2CacheSize / 2)
+            matmulOptimalM /= 2;
+    }
 
     batch0 = dimsMatMul0Out[0];
     batch1 = dimsMatMul0Out[1];
@@ -1092,15 +1117,7 @@ void MHA::prepareParams() {
         jcp.with_scales1 = !fqScales2.empty();
         jcp.broadcast_scales1 = fqScales2.size() == 1;
 
-#if defined(OPENVINO_ARCH_X86_64)
-        if (mayiuse(cpu_isa_t::avx512_core)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx512_core>(jcp));
-        } else if (mayiuse(cpu_isa_t::avx2)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx2>(jcp));
-        } else if (mayiuse(cpu_isa_t::sse41)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::sse41>(jcp));
-        }
-#endif // OPENVINO_ARCH_X86_64
+        mulAddSoftmaxKernel = createMulAddSoftmaxKernel(jcp);
         if (!mulAddSoftmaxKernel) {
             THROW_ERROR << "cannot create jit eltwise kernel";
         }
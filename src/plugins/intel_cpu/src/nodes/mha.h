@@ -56,6 +56,11 @@ struct jit_uni_mul_add_softmax_kernel {
     jit_mul_add_softmax_compile_params jcp_;
 };
 
+// Creates the fused mul+add+softmax row kernel for the best available ISA, or returns an
+// empty pointer when no JIT implementation is available. Also used by the MaskedSoftmax
+// node, which reuses the same single pass row sweep outside of the MHA pattern.
+std::unique_ptr<jit_uni_mul_add_softmax_kernel> createMulAddSoftmaxKernel(const jit_mul_add_softmax_compile_params& jcp);
+
 struct jit_convert_reorder_compile_params {
     InferenceEngine::Precision src_prc;
     InferenceEngine::Precision dst_prc;
@@ -127,6 +127,10 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
         } else {
             mov(reg_sum, ptr[reg_params + GET_OFF(sum)]);
             uni_vpxor(vmm_sum, vmm_sum, vmm_sum);
+            if (jcp_.single_pass) {
+                mov(reg_variance, ptr[reg_params + GET_OFF(variance)]);
+                uni_vpxor(vmm_variance, vmm_variance, vmm_variance);
+            }
         }
         mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
         mov(reg_stride, ptr[reg_params + GET_OFF(src_stride)]);
@@ -152,7 +156,9 @@ struct jit_uni_mvn_mean_variance_kernel_f32 : public jit_uni_mvn_mean_variance_k
             if (!jcp_.normalize_variance && !isFloatCompatible(jcp_.src_prc))
                 uni_vcvtdq2ps(vmm_sum, vmm_sum);
             Vmm vmm_dst = jcp_.normalize_variance ? vmm_variance : vmm_sum;
-            reduce_sum_store_vmm(vmm_dst.getIdx());
+            reduce_sum_store_vmm(vmm_dst.getIdx(), jcp_.normalize_variance);
+            if (jcp_.single_pass)
+                reduce_sum_store_vmm(vmm_variance.getIdx(), true);
         } else if (jcp_.layout == MVNLayoutType::mvn_by_channel) {
             if (jcp_.across_channels)
                 nspc_ac_ker();
@@ -327,7 +333,7 @@ private:
         if (!jcp_.normalize_variance && !isFloatCompatible(jcp_.src_prc))
             uni_vcvtdq2ps(vmm_sum, vmm_sum);
         Vmm vmm_dst = jcp_.normalize_variance ? vmm_variance : vmm_sum;
-        reduce_sum_store_vmm(vmm_dst.getIdx());
+        reduce_sum_store_vmm(vmm_dst.getIdx(), jcp_.normalize_variance);
     }
 
     // nspc per channel with unroll
@@ -425,7 +431,8 @@ private:
 
     inline void worker_unroll(bool is_tail = false) {
         // if mean(sum) for continous data, then fast pass for major part
-        if (!jcp_.normalize_variance && jcp_.layout == MVNLayoutType::mvn_planar) {
+        // (the dp paths accumulate the sum only, so they cannot serve the single-pass mode)
+        if (!jcp_.normalize_variance && !jcp_.single_pass && jcp_.layout == MVNLayoutType::mvn_planar) {
             Vmm vmm_one = Vmm(15);
             // i8/u8 fast path
             if (mayiuse(avx512_core_vnni) && jcp_.src_data_size == 1) {
@@ -510,6 +517,12 @@ private:
                 uni_vpaddd(vmm_sum, vmm_sum, vmm_val);
             else
                 uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            if (jcp_.single_pass) {
+                // raw second moment shares the sweep with the sum
+                if (!isFloatCompatible(jcp_.src_prc))
+                    uni_vcvtdq2ps(vmm_val, vmm_val);
+                uni_vfmadd231ps(vmm_variance, vmm_val, vmm_val);
+            }
         }
     }
 
@@ -555,30 +568,36 @@ private:
                 uni_vpaddd(vmm_sum, vmm_sum, vmm_val);
             else
                 uni_vaddps(vmm_sum, vmm_sum, vmm_val);
+            if (jcp_.single_pass) {
+                // loads are zero-filled, so the padded lanes contribute nothing to the squares
+                if (!isFloatCompatible(jcp_.src_prc))
+                    uni_vcvtdq2ps(vmm_val, vmm_val);
+                uni_vfmadd231ps(vmm_variance, vmm_val, vmm_val);
+            }
         }
     }
 
-    inline void reduce_sum_store_xmm(Xbyak::Xmm xmm_sum) {
+    inline void reduce_sum_store_xmm(Xbyak::Xmm xmm_sum, bool to_variance) {
         uni_vmovshdup(xmm_aux3, xmm_sum);            //  sum:1,2,3,4; aux3:2,2,4,4
         uni_vaddps(xmm_sum, xmm_sum, xmm_aux3);      //  sum:1+2,2+2,3+4,4+4
         uni_vmovhlps(xmm_aux3, xmm_aux3, xmm_sum);   //  aux3:3+4,4+4,4,4
         uni_vaddps(xmm_sum, xmm_sum,  xmm_aux3);     //  sum:1+2+3+4,...
-        if (jcp_.normalize_variance) {
+        if (to_variance) {
             uni_vmovss(ptr[reg_variance], xmm_sum);
         } else {
             uni_vmovss(ptr[reg_sum], xmm_sum);
         }
     }
 
-    inline void reduce_sum_store_vmm(int vmm_idx) {
+    inline void reduce_sum_store_vmm(int vmm_idx, bool to_variance) {
         if (isa == cpu::x64::sse41) {
-            reduce_sum_store_xmm(Xmm(vmm_idx));
+            reduce_sum_store_xmm(Xmm(vmm_idx), to_variance);
         } else if (isa == cpu::x64::avx2) {
             Xbyak::Ymm ymm_sum = Xbyak::Ymm(vmm_idx);
             vextractf128(xmm_aux1, ymm_sum, 0);
             vextractf128(xmm_aux2, ymm_sum, 1);
             uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
-            reduce_sum_store_xmm(xmm_aux1);
+            reduce_sum_store_xmm(xmm_aux1, to_variance);
         } else {
             Xbyak::Zmm zmm_sum = Xbyak::Zmm(vmm_idx);
             vextractf32x4(xmm_aux1, zmm_sum, 0);
@@ -588,7 +607,7 @@ private:
             vextractf32x4(xmm_aux3, zmm_sum, 3);
             uni_vaddps(xmm_aux2, xmm_aux2, xmm_aux3);
             uni_vaddps(xmm_aux1, xmm_aux1, xmm_aux2);
-            reduce_sum_store_xmm(xmm_aux1);
+            reduce_sum_store_xmm(xmm_aux1, to_variance);
         }
     }
 
@@ -1285,6 +1304,9 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
     jcp.layout = mvnAttrs.layout;
     jcp.normalize_variance = mvnAttrs.normalizeVariance_;
     jcp.across_channels = mvnAttrs.execAcrossChannels_;
+    // on the planar path the mean kernel gathers the raw second moment together with the sum,
+    // so the statistics cost one sweep over the data and no variance kernel is needed
+    jcp.single_pass = mvnAttrs.normalizeVariance_ && jcp.layout == MVNLayoutType::mvn_planar;
     int N = 0;
     std::tie(N, jcp.C, jcp.D, jcp.H, jcp.W) = mvnAttrs.shape5D;
 #if defined(OPENVINO_ARCH_X86_64)
@@ -1292,7 +1314,7 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx512_core>(jcp, *attr.get()));
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_core>(jcp));
-        if (mvnAttrs.normalizeVariance_) {
+        if (mvnAttrs.normalizeVariance_ && !jcp.single_pass) {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx512_core>(jcp));
         }
@@ -1300,7 +1322,7 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
-        if (mvnAttrs.normalizeVariance_) {
+        if (mvnAttrs.normalizeVariance_ && !jcp.single_pass) {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::avx2>(jcp));
         }
@@ -1308,7 +1330,7 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
         mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
         jcp.normalize_variance = false;
         mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
-        if (mvnAttrs.normalizeVariance_) {
+        if (mvnAttrs.normalizeVariance_ && !jcp.single_pass) {
             jcp.normalize_variance = true;
             mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::x64::sse41>(jcp));
         }
@@ -1325,7 +1347,7 @@ MVN::MVNJitExecutor::MVNJitExecutor(const MVNAttrs& mvnAttrs,
 }
 
 void MVN::MVNJitExecutor::exec(const uint8_t *src_data, uint8_t *dst_data, const void *post_ops_data_) {
-    if (!mvn_mean_kernel || (mvnAttrs.normalizeVariance_ && !mvn_variance_kernel) || !mvn_kernel) {
+    if (!mvn_mean_kernel || (mvnAttrs.normalizeVariance_ && !mvn_variance_kernel && mvnAttrs.layout != MVNLayoutType::mvn_planar) || !mvn_kernel) {
         IE_THROW() << "MVN layer doesn't create kernel to execute on sse41 above platform.";
     }
     if (mvnAttrs.layout == MVNLayoutType::mvn_planar) {
@@ -1494,48 +1516,38 @@ void MVN::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* dst_data, co
     if (mvnAttrs.execAcrossChannels_) {
         parallel_for(N, [&](int b) {
             size_t cb = b * C3;
-            // Calculate mean value for one instance in batch
-            // Parallel sum for each channel
             float C3inv = 1.f / static_cast<float>(C3);
-            float mean_temp = 0.0f;
-            mean_temp = parallel_sum(C, mean_temp, [&](size_t c)->float {
-                float mean_internal = 0.0f;
-                size_t cc = cb + c * C2;
-                auto arg = jit_mvn_call_args();
-                arg.src = src_data + cc * src_data_size;
-                arg.sum = static_cast<float*>(&mean_internal);
-                arg.src_stride = src_stride_size;
-                arg.work_amount = static_cast<size_t>(C2 / blk_size); // for vector part
-                arg.post_op_data = post_ops_data_;
-                (*mvn_mean_kernel)(&arg);
-                return mean_internal;
-            });
-
-            float mean = mean_temp * C3inv;
-
-            // calculate variance value for one instance in batch
-            // parallel sum for each channel
             if (mvnAttrs.normalizeVariance_) {
-                float variance_temp = 0.0f;
-                variance_temp = parallel_sum(C, variance_temp, [&](size_t c)->float {
-                    float variance_internal = 0.0f;
+                // Calculate mean and raw second moment for one instance in batch in a single
+                // pass over the data: the mean kernel reports both sums per channel
+                std::vector<float> sum_buffer(C, 0.0f);
+                std::vector<float> sqsum_buffer(C, 0.0f);
+                parallel_for(C, [&](size_t c) {
                     size_t cc = cb + c * C2;
                     auto arg = jit_mvn_call_args();
                     arg.src = src_data + cc * src_data_size;
-                    arg.mean = static_cast<float*>(&mean);
-                    arg.variance = static_cast<float*>(&variance_internal);
+                    arg.sum = static_cast<float*>(&sum_buffer[c]);
+                    arg.variance = static_cast<float*>(&sqsum_buffer[c]);
                     arg.src_stride = src_stride_size;
-                    arg.work_amount = static_cast<size_t>(C2 / blk_size);  // vector part
+                    arg.work_amount = static_cast<size_t>(C2 / blk_size); // for vector part
                     arg.post_op_data = post_ops_data_;
-                    (*mvn_variance_kernel)(&arg);
-                    return variance_internal;
+                    (*mvn_mean_kernel)(&arg);
                 });
+                float sum_temp = 0.0f;
+                float sqsum_temp = 0.0f;
+                for (size_t c = 0; c < C; c++) {
+                    sum_temp += sum_buffer[c];
+                    sqsum_temp += sqsum_buffer[c];
+                }
+                float mean = sum_temp * C3inv;
+                // guard against cancellation on nearly constant data
+                float variance_temp = std::max(sqsum_temp * C3inv - mean * mean, 0.0f);
 
                 float variance = 1.f;
                 if (mvnAttrs.epsMode_ == INSIDE_SQRT)
-                    variance /= sqrtf(variance_temp * C3inv + mvnAttrs.epsValue_);
+                    variance /= sqrtf(variance_temp + mvnAttrs.epsValue_);
                 else if (mvnAttrs.epsMode_ == OUTSIDE_SQRT)
-                    variance /= sqrtf(variance_temp * C3inv) + mvnAttrs.epsValue_;
+                    variance /= sqrtf(variance_temp) + mvnAttrs.epsValue_;
 
                 // mvn for one instance in batch
                 parallel_for(C, [&](int c) {
@@ -1553,6 +1565,24 @@ void MVN::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* dst_data, co
                     (*mvn_kernel)(&arg);
                 });
             } else {
+                // Calculate mean value for one instance in batch
+                // Parallel sum for each channel
+                float mean_temp = 0.0f;
+                mean_temp = parallel_sum(C, mean_temp, [&](size_t c)->float {
+                    float mean_internal = 0.0f;
+                    size_t cc = cb + c * C2;
+                    auto arg = jit_mvn_call_args();
+                    arg.src = src_data + cc * src_data_size;
+                    arg.sum = static_cast<float*>(&mean_internal);
+                    arg.src_stride = src_stride_size;
+                    arg.work_amount = static_cast<size_t>(C2 / blk_size); // for vector part
+                    arg.post_op_data = post_ops_data_;
+                    (*mvn_mean_kernel)(&arg);
+                    return mean_internal;
+                });
+
+                float mean = mean_temp * C3inv;
+
                 // mvn for one instance in batch
                 parallel_for(C, [&](int c) {
                     size_t cc = cb + c * C2;
@@ -1575,13 +1605,15 @@ void MVN::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* dst_data, co
             size_t cc = cb + c * C2;
             float C2inv = 1.f / static_cast<float>(C2);
 
-            // mean for this channel
+            // mean and raw second moment for this channel, single pass over the data
             float mean = 0.f;
-            // the same arg for three kernels
+            float sqsum = 0.f;
+            // the same arg for both kernels
             auto arg = jit_mvn_call_args();
             arg.src = src_data + cc * src_data_size;
             arg.dst = dst_data + cc * dst_data_size;
             arg.sum = static_cast<float*>(&mean);
+            arg.variance = static_cast<float*>(&sqsum);
             arg.src_stride = src_stride_size;
             arg.dst_stride = dst_stride_size;
             arg.work_amount = static_cast<size_t>(C2 / blk_size);
@@ -1592,16 +1624,16 @@ void MVN::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* dst_data, co
             mean *= C2inv;
 
             if (mvnAttrs.normalizeVariance_) {
-                // variance for this channel
-                float variance = 0.f;
+                // variance for this channel, derived from the same pass as the mean;
+                // guard against cancellation on nearly constant data
+                float variance = std::max(sqsum * C2inv - mean * mean, 0.f);
                 arg.mean = static_cast<float*>(&mean);
-                arg.variance = static_cast<float*>(&variance);
-                (*mvn_variance_kernel)(&arg);
 
                 if (mvnAttrs.epsMode_ == INSIDE_SQRT)
-                    variance = 1.f / sqrtf(variance * C2inv + mvnAttrs.epsValue_);
+                    variance = 1.f / sqrtf(variance + mvnAttrs.epsValue_);
                 else if (mvnAttrs.epsMode_ == OUTSIDE_SQRT)
-                    variance = 1.f / (sqrtf(variance * C2inv) + mvnAttrs.epsValue_);
+                    variance = 1.f / (sqrtf(variance) + mvnAttrs.epsValue_);
+                arg.variance = static_cast<float*>(&variance);
 
                 // mvn for this channel
                 (*mvn_kernel)(&arg);
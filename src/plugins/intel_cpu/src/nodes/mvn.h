@@ -19,6 +19,9 @@ struct jit_mvn_config_params {
     MVNLayoutType layout;
     bool across_channels;
     bool normalize_variance;
+    // mean kernel also accumulates the raw second moment into the variance slot,
+    // so no separate variance sweep over the data is needed (planar layout only)
+    bool single_pass;
     InferenceEngine::Precision src_prc;
     InferenceEngine::Precision dst_prc;
     int src_data_size;
@@ -1008,24 +1008,36 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
         int io_selection_size = 0;
         size_t sortedBoxSize = sorted_boxes.size();
         if (sortedBoxSize > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
+            // selection consumes candidates in descending score order but stops after max_out_box accepted
+            // boxes, which is typically a small fraction of the candidates; pop them lazily from a heap
+            // instead of fully sorting the whole score-filtered set
+            auto heapCmp = [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                return (l.first < r.first || ((l.first == r.first) && (l.second > r.second)));
+            };
+            std::make_heap(sorted_boxes.begin(), sorted_boxes.end(), heapCmp);
+            auto nextCandidate = [&]() {
+                std::pop_heap(sorted_boxes.begin(), sorted_boxes.end(), heapCmp);
+                auto candidate = sorted_boxes.back();
+                sorted_boxes.pop_back();
+                return candidate;
+            };
+
             int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
+            const auto topBox = nextCandidate();
+            filtBoxes[offset + 0] = filteredBoxes(topBox.first, batch_idx, class_idx, topBox.second);
             io_selection_size++;
             if (sortedBoxSize > 1) {
                 if (nms_kernel) {
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
+                    const size_t maxSelectedNum = std::min(sortedBoxSize, static_cast<size_t>(std::max(max_out_box, 1)));
+                    std::vector<float> boxCoord0(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord1(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord2(maxSelectedNum, 0.0f);
+                    std::vector<float> boxCoord3(maxSelectedNum, 0.0f);
 
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
+                    boxCoord0[0] = boxesPtr[topBox.second * 4];
+                    boxCoord1[0] = boxesPtr[topBox.second * 4 + 1];
+                    boxCoord2[0] = boxesPtr[topBox.second * 4 + 2];
+                    boxCoord3[0] = boxesPtr[topBox.second * 4 + 3];
 
                     auto arg = jit_nms_args();
                     arg.iou_threshold = static_cast<float*>(&iouThreshold);
@@ -1037,27 +1049,29 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
                     arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
                     arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
 
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while (!sorted_boxes.empty() && io_selection_size < max_out_box) {
+                        const auto candidateBox = nextCandidate();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * 4]);
+                        arg.candidate_box = static_cast<const float*>(&boxesPtr[candidateBox.second * 4]);
                         arg.candidate_status = static_cast<int*>(&candidateStatus);
                         (*nms_kernel)(&arg);
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
-                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
-                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
-                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
+                            boxCoord0[io_selection_size] = boxesPtr[candidateBox.second * 4];
+                            boxCoord1[io_selection_size] = boxesPtr[candidateBox.second * 4 + 1];
+                            boxCoord2[io_selection_size] = boxesPtr[candidateBox.second * 4 + 2];
+                            boxCoord3[io_selection_size] = boxesPtr[candidateBox.second * 4 + 3];
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
                             io_selection_size++;
                         }
                     }
                 } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
+                    while (!sorted_boxes.empty() && io_selection_size < max_out_box) {
+                        const auto candidateBox = nextCandidate();
                         int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
                         for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
+                            float iou = intersectionOverUnion(&boxesPtr[candidateBox.second * 4],
                                 &boxesPtr[filtBoxes[offset + selected_idx].box_index * 4]);
                             if (iou >= iouThreshold) {
                                 candidateStatus = NMSCandidateStatus::SUPPRESSED;
@@ -1067,7 +1081,7 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
 
                         if (candidateStatus == NMSCandidateStatus::SELECTED) {
                             filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                                filteredBoxes(candidateBox.first, batch_idx, class_idx, candidateBox.second);
                             io_selection_size++;
                         }
                     }
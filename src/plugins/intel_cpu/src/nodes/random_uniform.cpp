@@ -0,0 +1,236 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <ngraph/op/random_uniform.hpp>
+#include "ie_parallel.hpp"
+#include "random_uniform.h"
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+namespace {
+
+// Philox 4x32-10 constants, see the "Parallel Random Numbers: As Easy as 1, 2, 3" paper.
+// The values match the ngraph reference implementation so both produce the same streams.
+constexpr uint32_t crushResistanceLowerValue = 0x9E3779B9;
+constexpr uint32_t crushResistanceUpperValue = 0xBB67AE85;
+constexpr uint64_t statisticMaximizingMultiplierN = 0xD2511F53;
+constexpr uint64_t statisticMaximizingMultiplierCounter = 0xCD9E8D57;
+constexpr size_t roundsNumber = 10lu;
+// Determines how many sequence elements of RNG are reserved per one output element
+// between consecutive runs. Kept at 256 for parity with the reference and Tensorflow.
+constexpr uint64_t skipConst = 256lu;
+
+union convertTypes {
+    uint32_t ui32;
+    float f32;
+};
+
+// Runs single round of the Philox algorithm over the (counter, n) pair.
+inline void calculateRound(uint64_t key, uint64_t& counter, uint64_t& n) {
+    const uint32_t keyLow = static_cast<uint32_t>(key);
+    const uint32_t keyHigh = static_cast<uint32_t>(key >> 32);
+    const uint32_t nLow = static_cast<uint32_t>(n);
+    const uint32_t nHigh = static_cast<uint32_t>(n >> 32);
+    const uint32_t counterLow = static_cast<uint32_t>(counter);
+    const uint32_t counterHigh = static_cast<uint32_t>(counter >> 32);
+
+    const uint64_t prod0 = statisticMaximizingMultiplierN * nLow;
+    const uint64_t prod1 = statisticMaximizingMultiplierCounter * counterLow;
+
+    n = (static_cast<uint64_t>(static_cast<uint32_t>(prod1)) << 32) +
+        (static_cast<uint32_t>(prod1 >> 32) ^ nHigh ^ keyLow);
+    counter = (static_cast<uint64_t>(static_cast<uint32_t>(prod0)) << 32) +
+              (static_cast<uint32_t>(prod0 >> 32) ^ counterHigh ^ keyHigh);
+}
+
+inline void raiseKey(uint64_t& key) {
+    uint32_t keyLow = static_cast<uint32_t>(key);
+    uint32_t keyHigh = static_cast<uint32_t>(key >> 32);
+    keyLow += crushResistanceLowerValue;
+    keyHigh += crushResistanceUpperValue;
+    key = (static_cast<uint64_t>(keyHigh) << 32) + keyLow;
+}
+
+// Runs the full Philox algorithm producing four uint32 values per (counter, n) pair.
+inline void runPhilox(uint64_t key, uint64_t counter, uint64_t n, uint32_t res[4]) {
+    for (size_t i = 0lu; i < roundsNumber; i++) {
+        calculateRound(key, counter, n);
+        if (i < roundsNumber - 1)
+            raiseKey(key);
+    }
+    res[0] = static_cast<uint32_t>(n);
+    res[1] = static_cast<uint32_t>(n >> 32);
+    res[2] = static_cast<uint32_t>(counter);
+    res[3] = static_cast<uint32_t>(counter >> 32);
+}
+
+// Sets the mantissa of 1.0f with bits from the uint32 value and subtracts one,
+// giving a value in [0, 1) with the same bit pattern as the reference implementation.
+inline float uint32ToFloat(uint32_t x) {
+    convertTypes outVal = {(static_cast<uint32_t>(127) << 23) | (x & 0x7fffffu)};
+    return outVal.f32 - 1.0f;
+}
+
+}  // namespace
+
+bool RandomUniform::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        const auto randomUniformOp = ngraph::as_type_ptr<const ngraph::op::v8::RandomUniform>(op);
+        if (!randomUniformOp) {
+            errorMessage = "Node is not an instance of the RandomUniform operation from operation set v8.";
+            return false;
+        }
+        const auto outType = randomUniformOp->get_out_type();
+        if (outType != ngraph::element::f32 && outType != ngraph::element::i32) {
+            errorMessage = "Doesn't support output type: " + outType.get_type_name();
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+RandomUniform::RandomUniform(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
+    : Node(op, context, NgraphShapeInferFactory(op, PortMask(0))) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "RandomUniform layer with name '" + op->get_friendly_name() + "' ";
+    if (getOriginalInputsNumber() != 3)
+        IE_THROW() << errorPrefix << "has invalid number of input edges: " << getOriginalInputsNumber();
+    if (getOriginalOutputsNumber() != 1)
+        IE_THROW() << errorPrefix << "has invalid number of outputs edges: " << getOriginalOutputsNumber();
+
+    const auto randomUniformOp = ngraph::as_type_ptr<const ngraph::op::v8::RandomUniform>(op);
+    globalSeed = randomUniformOp->get_global_seed();
+    opSeed = randomUniformOp->get_op_seed();
+    // When both seed values are equal to zero RandomUniform should generate non-deterministic sequence.
+    if (globalSeed == 0lu && opSeed == 0lu) {
+        std::srand(static_cast<unsigned int>(std::time(nullptr)));
+        globalSeed = std::rand();
+    }
+}
+
+void RandomUniform::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    outPrec = getOriginalOutputPrecisionAtPort(0);
+    if (outPrec != Precision::FP32 && outPrec != Precision::I32)
+        IE_THROW() << errorPrefix << "has unsupported output precision: " << outPrec;
+
+    addSupportedPrimDesc({{LayoutType::ncsp, Precision::I32},
+                          {LayoutType::ncsp, outPrec},
+                          {LayoutType::ncsp, outPrec}},
+                         {{LayoutType::ncsp, outPrec}},
+                         impl_desc_type::ref_any);
+}
+
+template <typename T, typename ConvertFunc>
+void RandomUniform::generateData(T* out, size_t elemCount, T minVal, T maxVal, ConvertFunc&& convert) {
+    const uint64_t key = globalSeed;
+    const uint64_t counter0 = counterState > 0lu ? counterState : opSeed;
+    const uint64_t n0 = nState;
+
+    // Each Philox invocation yields four uint32 values converted to four output elements.
+    const size_t step = 4lu;
+    const size_t groupCount = (elemCount + step - 1) / step;
+
+    // The generator is counter based: the group of four values at position 'group' is fully
+    // determined by the (counter, n0 + group) pair, so the groups can be produced on any
+    // number of threads in any order while staying bit-identical to the serial reference,
+    // which advances the pair with "if (++n == 0) ++counter;" after every group.
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(groupCount, nthr, ithr, start, end);
+        uint32_t res[4];
+        for (size_t group = start; group < end; group++) {
+            const uint64_t n = n0 + group;
+            const uint64_t counter = n < n0 ? counter0 + 1lu : counter0;
+            runPhilox(key, counter, n, res);
+            const size_t k = group * step;
+            const size_t count = std::min(step, elemCount - k);
+            for (size_t i = 0lu; i < count; i++) {
+                out[k + i] = convert(res[i], minVal, maxVal);
+            }
+        }
+    });
+
+    // Reserve RNG sequence positions for the next run, exactly as the reference does.
+    const uint64_t skipCount = elemCount * skipConst;
+    nState += skipCount;
+    if (nState < skipCount)
+        counterState++;
+}
+
+void RandomUniform::execute(dnnl::stream strm) {
+    const auto& dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    const size_t elemCount = std::accumulate(dstDims.begin(), dstDims.end(), size_t(1), std::multiplies<size_t>());
+
+    if (outPrec == Precision::FP32) {
+        const float minVal = reinterpret_cast<const float*>(getParentEdgeAt(MIN_VAL_INDEX)->getMemoryPtr()->GetPtr())[0];
+        const float maxVal = reinterpret_cast<const float*>(getParentEdgeAt(MAX_VAL_INDEX)->getMemoryPtr()->GetPtr())[0];
+        generateData<float>(reinterpret_cast<float*>(dstMemPtr->GetPtr()),
+                            elemCount,
+                            minVal,
+                            maxVal,
+                            [](uint32_t x, float mn, float mx) {
+                                return uint32ToFloat(x) * (mx - mn) + mn;
+                            });
+    } else {
+        const int minVal = reinterpret_cast<const int*>(getParentEdgeAt(MIN_VAL_INDEX)->getMemoryPtr()->GetPtr())[0];
+        const int maxVal = reinterpret_cast<const int*>(getParentEdgeAt(MAX_VAL_INDEX)->getMemoryPtr()->GetPtr())[0];
+        generateData<int>(reinterpret_cast<int*>(dstMemPtr->GetPtr()),
+                          elemCount,
+                          minVal,
+                          maxVal,
+                          [](uint32_t x, int mn, int mx) {
+                              return static_cast<int>(x % (mx - mn) + mn);
+                          });
+    }
+}
+
+void RandomUniform::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+bool RandomUniform::needPrepareParams() const {
+    return false;
+}
+
+bool RandomUniform::needShapeInfer() const {
+    // The output dims are dictated by the values in the 'shape' input, not by its own shape.
+    const auto& shapeMem = getParentEdgesAtPort(SHAPE_INDEX)[0]->getMemory();
+    const int32_t* shapeData = reinterpret_cast<const int32_t*>(shapeMem.GetPtr());
+    const size_t shapeElems = shapeMem.getStaticDims()[0];
+    VectorDims newOutputDims(shapeData, shapeData + shapeElems);
+    if (newOutputDims != lastOutputDims) {
+        lastOutputDims = std::move(newOutputDims);
+        return true;
+    }
+    return Node::needShapeInfer();
+}
+
+bool RandomUniform::created() const {
+    return getType() == Type::RandomUniform;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <node.h>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class RandomUniform : public Node {
+public:
+    RandomUniform(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+    bool needPrepareParams() const override;
+    bool needShapeInfer() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    template <typename T, typename ConvertFunc>
+    void generateData(T* out, size_t elemCount, T minVal, T maxVal, ConvertFunc&& convert);
+
+    const size_t SHAPE_INDEX = 0lu;
+    const size_t MIN_VAL_INDEX = 1lu;
+    const size_t MAX_VAL_INDEX = 2lu;
+
+    uint64_t globalSeed = 0lu;
+    uint64_t opSeed = 0lu;
+    // Philox generator state carried between inference calls, advanced exactly as in
+    // the ngraph reference implementation so the produced streams stay bit-identical.
+    uint64_t nState = 0lu;
+    uint64_t counterState = 0lu;
+
+    InferenceEngine::Precision outPrec = InferenceEngine::Precision::UNSPECIFIED;
+    mutable VectorDims lastOutputDims;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
@@ -1762,6 +1762,7 @@ Reduce::Reduce(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr
             raw_axes = reduceConst->cast_vector<int>();
         }
         vec_reduceDH_prc.clear();
+        vec_reduceW_prc.clear();
         setJITBeyond5D();
     } else {
         IE_THROW(NotImplemented) << errorMessage;
@@ -2044,7 +2045,7 @@ void Reduce::createPrimitive() {
 
     create_reduce_kernel(reduce_kernel, jcp);
 
-    // For scenarios(e.g. when ReduceDH_opt or ReduceAll_opt is true) that apply two stages of kernel invocation
+    // For scenarios(e.g. when ReduceDH_opt, ReduceW_opt or ReduceAll_opt is true) that apply two stages of kernel invocation
     // to improve parallelism, if the precision is asymmetrical, we apply the aux kernel on the second stage. For
     // example, if the original kernel is bf16-in-fp32-out, then this original kernel will be applied on first
     // stage to reduce some dimensions, and an extra fp32-in-fp32-out aux kernel will be applied on the second
@@ -2174,6 +2175,34 @@ void Reduce::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
                         reduce_kernel_process(in_ptr_n + (tail_start + it) * inner_size * src_data_size,
                                               out_ptr_n + (tail_start + ot) * output_inner_size * dst_data_size, work_amount, 1);
                     });
+                } else if (ReduceW_opt) {
+                    // reduce parallelly in W dimension: there are fewer rows than threads, so
+                    // split each row into PK chunks reduced into per-chunk private accumulators
+                    // step1: partial reduction of every chunk
+                    uint8_t *prc_ptr_n = &vec_reduceW_prc[0];
+                    init_dst_data(prc_ptr_n, prc_size);
+                    size_t chunk_size = div_up(div_up(work_amount, PK), blk_size) * blk_size;
+                    size_t chunks = div_up(work_amount, chunk_size);
+                    parallel_for2d(PR, chunks, [&](size_t ir, size_t ik) {
+                        size_t pr = ir, pk = ik;
+                        size_t chunk_start = ik * chunk_size;
+                        reduce_kernel_process(in_ptr_n + (ir * work_amount + chunk_start) * src_data_size,
+                                              prc_ptr_n + (pr * PK + pk) * prc_data_size,
+                                              std::min(chunk_size, work_amount - chunk_start), 1);
+                    });
+                    // step2: combine the chunk partials of each row
+                    if (use_aux_kernel) {
+                        reduce_tmp_kernel = reduce_kernel;
+                        reduce_kernel = reduce_aux_kernel;
+                    }
+                    parallel_for(PR, [&](size_t pr) {
+                        size_t our = pr;
+                        reduce_kernel_process(prc_ptr_n + pr * PK * prc_data_size,
+                                              out_ptr_n + our * dst_data_size, chunks, 1);
+                    });
+                    if (use_aux_kernel) {
+                        reduce_kernel = reduce_tmp_kernel;
+                    }
                 } else {
                     if (ReduceH) {
                         parallel_for2d(IC, ID, [&](size_t ic, size_t id) {
@@ -2759,6 +2788,23 @@ inline void Reduce::create_DH_working_memory() {
     }
 }
 
+inline void Reduce::create_W_working_memory() {
+    size_t rows = ReduceH ? IC * ID : IC * ID * IH;
+    size_t row_size = ReduceH ? IH * IW : IW;
+    size_t threads_num = static_cast<size_t>(parallel_get_max_threads());
+    ReduceW_opt = layout == ReduceLayoutType::reduce_ncsp && !isDynamicNode() && support_split &&
+                  !ReduceC && !ReduceD && ReduceW && rows < threads_num && row_size >= 4 * blk_size * threads_num;
+    if (ReduceW_opt) {
+        PR = rows;
+        PK = div_up(threads_num, rows);
+        prc_data_size = dst_data_size;
+        prc_size = PR * PK * dst_data_size;
+        if (prc_size > vec_reduceW_prc.size()) {
+            vec_reduceW_prc.resize(prc_size);
+        }
+    }
+}
+
 inline void Reduce::calc_process_dst_dims(std::vector<int> &reduce_axes, const SizeVector &dst_dims) {
     std::set<size_t> axes;
     SizeVector out_dims;
@@ -2844,10 +2890,11 @@ inline void Reduce::set_reduce_dim_flags() {
 
     // must be done after the above dimension change
     create_DH_working_memory();
+    create_W_working_memory();
 
     ReduceAll_opt = layout == ReduceLayoutType::reduce_blocked && !isDynamicNode() && support_split &&
                     ReduceC && ReduceD && ReduceH && ReduceW;
-    use_aux_kernel = (ReduceDH_opt || ReduceAll_opt) && precision_change;
+    use_aux_kernel = (ReduceDH_opt || ReduceW_opt || ReduceAll_opt) && precision_change;
 
     // suit for parallel
     if (ReduceH && IW == 1) {
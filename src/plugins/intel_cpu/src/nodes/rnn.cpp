@@ -4,6 +4,7 @@
 
 #include "rnn.h"
 #include <utils/general_utils.h>
+#include "ie_parallel.hpp"
 #include "ie_precision.hpp"
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -713,23 +714,23 @@ void RNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t rIdx)
 
     const int step = SC * G;
 
-    for (int g = 0; g < G; g++) {
-        for (int out_i = 0; out_i < SC; out_i++) {
-            Prec *l_w_ptr = w_ptr + gate_map[g] * SC + out_i;
-            for (int in_i = 0; in_i < DC; in_i++) {
-                *l_w_ptr = *ie_w_ptr;
-                ie_w_ptr++;
-                l_w_ptr += step;
-            }
+    // every (gate, output channel) pair reads and writes a disjoint stride of the weight blobs,
+    // so the gate reorder of the full matrices is parallelized over them
+    parallel_for2d(G, SC, [&](size_t g, size_t out_i) {
+        Prec *l_w_ptr = w_ptr + gate_map[g] * SC + out_i;
+        const Prec *s_w_ptr = ie_w_ptr + (g * SC + out_i) * DC;
+        for (size_t in_i = 0; in_i < DC; in_i++) {
+            *l_w_ptr = s_w_ptr[in_i];
+            l_w_ptr += step;
+        }
 
-            Prec *l_r_ptr = r_ptr + gate_map[g] * SC + out_i;
-            for (size_t in_i = 0; in_i < SC; in_i++) {
-                *l_r_ptr = *ie_r_ptr;
-                ie_r_ptr++;
-                l_r_ptr += step;
-            }
+        Prec *l_r_ptr = r_ptr + gate_map[g] * SC + out_i;
+        const Prec *s_r_ptr = ie_r_ptr + (g * SC + out_i) * SC;
+        for (size_t in_i = 0; in_i < SC; in_i++) {
+            *l_r_ptr = s_r_ptr[in_i];
+            l_r_ptr += step;
         }
-    }
+    });
 
     internalBlobs.push_back(w_data_mem);
     internalBlobs.push_back(w_state_mem);
@@ -906,10 +906,8 @@ void ROIAlign::executeSpecified() {
         }
     }
 
-    std::vector<int> numSamples(realRois);
-    std::vector<std::vector<float>> weightsTbl(realRois);
-    std::vector<std::vector<size_t>> srcAddressListTbl;
-    std::vector<std::vector<int>> srcIndexTbl;
+    numSamples.resize(realRois);
+    weightsTbl.resize(realRois);
     if (!isPlainFmt)
         srcAddressListTbl.resize(realRois);
     else
@@ -971,11 +969,11 @@ void ROIAlign::executeSpecified() {
         float sampleDistanceY = binHeight / samplingRatioY;
         // prepare arrays for sampling points and weights
         size_t paramsSize = BLIParamsNum * numSamplesInBin * binCount;
-        weightsTbl[n] = std::vector<float>(paramsSize, 0.f);
+        weightsTbl[n].assign(paramsSize, 0.f);
         if (!isPlainFmt)
-            srcAddressListTbl[n] = std::vector<size_t>(paramsSize, 0);
+            srcAddressListTbl[n].assign(paramsSize, 0);
         else
-            srcIndexTbl[n] = std::vector<int>(paramsSize, 0);
+            srcIndexTbl[n].assign(paramsSize, 0);
 
         size_t batchSrcOffset = roiBatchInd * batchInputStride;
         int idxIter = 0;
@@ -94,6 +94,13 @@ private:
     void createJitKernel(const InferenceEngine::Precision& dataPrec, const ROIAlignLayoutType& selectLayout);
     std::shared_ptr<jit_uni_roi_align_kernel> roi_align_kernel = nullptr;
 
+    // interpolation tables are recomputed every inference since ROIs are dynamic inputs,
+    // but their storage is kept on the node to avoid per-ROI heap allocations per inference
+    std::vector<int> numSamples;
+    std::vector<std::vector<float>> weightsTbl;
+    std::vector<std::vector<size_t>> srcAddressListTbl;
+    std::vector<std::vector<int>> srcIndexTbl;
+
     std::string errorPrefix;
 };
 
@@ -430,9 +430,13 @@ void ScatterUpdate::scatterNDUpdate(uint8_t *indices, uint8_t *update, uint8_t *
 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
 // output[i][indices[i][j][k]][k] = updates[i][j][k] if axis = 1,
 // output[i][j][indices[i][j][k]] = updates[i][j][k] if axis = 2.
-void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
-    const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
-    const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
+// The traversal is shared between the per-precision instantiations; the element copy is a compile-time
+// functor so that the common 1/2/4/8 byte precisions store directly instead of paying a cpu_memcpy call
+// per scattered element, which dominates this scalar kernel.
+template <typename CopyElement>
+static void scatterElementsTraverse(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData,
+                                    const VectorDims& srcDataDim, const VectorDims& updateDim,
+                                    size_t dataSize, size_t indicesSize, CopyElement copyElement) {
     size_t updateRank = updateDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
@@ -454,10 +458,11 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
             dst_idx += tensorItr[i] * srcBlockND[i + 1];
 
         for (size_t iwork = start; iwork < end; iwork++) {
-            int64_t idxValue = getIndicesValue(indices, iwork);
+            int64_t idxValue = (indicesSize == 4) ? reinterpret_cast<int32_t*>(indices)[iwork]
+                                                  : reinterpret_cast<int64_t*>(indices)[iwork];
             if (idxValue < static_cast<int64_t>(srcDataDim[axis]))
-                cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
-                            update + iwork * dataSize, dataSize);
+                copyElement(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
+                            update + iwork * dataSize);
 
             for (j = updateRank - 1; j >= 0; j--) {
                 tensorItr[j]++;
@@ -477,6 +482,46 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
     });
 }
 
+void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
+    const auto& srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
+    const auto& updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
+
+    switch (dataSize) {
+        case 1:
+            scatterElementsTraverse(indices, update, axis, dstData, srcDataDim, updateDim, dataSize, indicesSize,
+                                    [](uint8_t *dst, const uint8_t *src) {
+                                        *dst = *src;
+                                    });
+            break;
+        case 2:
+            scatterElementsTraverse(indices, update, axis, dstData, srcDataDim, updateDim, dataSize, indicesSize,
+                                    [](uint8_t *dst, const uint8_t *src) {
+                                        *reinterpret_cast<uint16_t*>(dst) = *reinterpret_cast<const uint16_t*>(src);
+                                    });
+            break;
+        case 4:
+            scatterElementsTraverse(indices, update, axis, dstData, srcDataDim, updateDim, dataSize, indicesSize,
+                                    [](uint8_t *dst, const uint8_t *src) {
+                                        *reinterpret_cast<uint32_t*>(dst) = *reinterpret_cast<const uint32_t*>(src);
+                                    });
+            break;
+        case 8:
+            scatterElementsTraverse(indices, update, axis, dstData, srcDataDim, updateDim, dataSize, indicesSize,
+                                    [](uint8_t *dst, const uint8_t *src) {
+                                        *reinterpret_cast<uint64_t*>(dst) = *reinterpret_cast<const uint64_t*>(src);
+                                    });
+            break;
+        default: {
+            const size_t elementSize = dataSize;
+            scatterElementsTraverse(indices, update, axis, dstData, srcDataDim, updateDim, dataSize, indicesSize,
+                                    [elementSize](uint8_t *dst, const uint8_t *src) {
+                                        cpu_memcpy(dst, src, elementSize);
+                                    });
+            break;
+        }
+    }
+}
+
 bool ScatterUpdate::created() const {
     return getType() == Type::ScatterUpdate
             || getType() == Type::ScatterElementsUpdate
@@ -670,6 +670,25 @@ void TensorIterator::prepareBackEdges() {
 
 void TensorIterator::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
+
+    // Shape-stable iterations (the common case for decoder style loops) leave every back edge
+    // descriptor intact, the body memory is not redefined anywhere else, so the mappers built on
+    // the previous iteration are still valid and may be reused as is.
+    if (back_mappers.size() == backEdges.size()) {
+        bool shapesUnchanged = true;
+        for (auto map_rule : backEdges) {
+            const auto& from_shape = output_mem[map_rule.from]->GetShape();
+            const auto& to_shape = input_mems[map_rule.to].front()->GetShape();
+            if (from_shape.isDynamic() || to_shape.isDynamic() ||
+                from_shape.getStaticDims() != to_shape.getStaticDims()) {
+                shapesUnchanged = false;
+                break;
+            }
+        }
+        if (shapesUnchanged)
+            return;
+    }
+
     back_mappers.clear();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
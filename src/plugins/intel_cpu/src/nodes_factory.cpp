@@ -63,6 +63,7 @@
 #include "nodes/deconv.h"
 #include "nodes/roi_pooling.h"
 #include "nodes/range.h"
+#include "nodes/random_uniform.h"
 #include "nodes/split.h"
 #include "nodes/one_hot.h"
 #include "nodes/log_softmax.h"
@@ -90,6 +91,7 @@
 #include "nodes/eye.h"
 #include "nodes/interaction.h"
 #include "nodes/mha.h"
+#include "nodes/masked_softmax.h"
 #include "nodes/unique.hpp"
 #include "nodes/ngram.h"
 
@@ -170,6 +172,7 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(Deconvolution, Type::Deconvolution);
     INTEL_CPU_NODE(DeformableConvolution, Type::DeformableConvolution);
     INTEL_CPU_NODE(Range, Type::Range);
+    INTEL_CPU_NODE(RandomUniform, Type::RandomUniform);
     INTEL_CPU_NODE(StridedSlice, Type::StridedSlice);
     INTEL_CPU_NODE(GRN, Type::GRN);
     INTEL_CPU_NODE(NonZero, Type::NonZero);
@@ -196,6 +199,7 @@ Node::NodesFactory::NodesFactory()
     INTEL_CPU_NODE(GridSample, Type::GridSample);
     INTEL_CPU_NODE(Interaction, Type::Interaction);
     INTEL_CPU_NODE(MHA, Type::MHA);
+    INTEL_CPU_NODE(MaskedSoftmax, Type::MaskedSoftmax);
     INTEL_CPU_NODE(Snippet, Type::Subgraph);
 #endif
 }
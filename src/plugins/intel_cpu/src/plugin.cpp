@@ -23,6 +23,11 @@
 
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/op/constant.hpp"
+
+#include <sstream>
+#include <unordered_map>
 
 #include "performance_heuristics.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -398,6 +403,32 @@ static bool shouldEnforceBF16(const std::map<std::string, std::string>& modelCon
     }
 }
 
+static void prefetchModelConstants(const std::shared_ptr<ngraph::Function>& function,
+                                   const ITaskExecutor::Ptr& executor) {
+    // the constants are collected up front: transformations may drop the nodes from
+    // the model, the shared pointers keep the original buffers alive until paged in
+    auto constants = std::make_shared<std::vector<std::shared_ptr<ngraph::op::Constant>>>();
+    for (const auto& op : function->get_ops()) {
+        if (auto constant = ngraph::as_type_ptr<ngraph::op::Constant>(op)) {
+            if (constant->get_byte_size() >= 2u * 4096u)
+                constants->push_back(constant);
+        }
+    }
+    if (constants->empty())
+        return;
+
+    executor->run([constants] {
+        constexpr size_t pageSize = 4096;
+        volatile uint8_t sink = 0;
+        for (const auto& constant : *constants) {
+            const auto* data = static_cast<const uint8_t*>(constant->get_data_ptr());
+            for (size_t i = 0; i < constant->get_byte_size(); i += pageSize)
+                sink += data[i];
+        }
+        (void)sink;
+    });
+}
+
 static Config::SnippetsMode getSnippetsMode(const std::map<std::string, std::string>& modelConfig, const Config& engineConfig) {
     const auto& dynamicBatchProp = modelConfig.find(InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_ENABLED);
     const bool enableDynamicBatch = (dynamicBatchProp != modelConfig.end() && dynamicBatchProp->second == PluginConfigParams::YES)
@@ -459,6 +490,12 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
+    // page the weights in on a background thread while the transformations run, so the
+    // I/O of a cold-started model overlaps with the CPU bound part of the compilation
+    prefetchModelConstants(nGraphFunc,
+                           executorManager()->getIdleCPUStreamsExecutor(
+                               IStreamsExecutor::Config{"CPUWeightsPrefetch", 1, 0, IStreamsExecutor::ThreadBindingType::NONE}));
+
     Transformations transformations(nGraphFunc, enableLPT, enableBF16, isLegacyAPI(), snippetsMode, engConfig);
     transformations.UpToCpuSpecificOpSet();
 
@@ -721,6 +758,121 @@ void Engine::AddExtension(const InferenceEngine::IExtensionPtr& extension) {
     extensionManager->AddExtension(extension);
 }
 
+namespace {
+// Folds all attributes reachable through the standard adapter types into a string, so that
+// supportability verdicts can be shared between identical ops within a single query. Ops with
+// attributes exposed only through custom adapters (including subgraph ops) are reported as
+// non-memoizable instead of risking a too coarse key.
+class NodeQuerySignatureVisitor : public ov::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        m_complete = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<void*>& adapter) override {
+        m_complete = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        m_complete = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        append(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        append(name, std::to_string(adapter.get()));
+    }
+
+#define CPU_QUERY_SIGNATURE_SCALAR(T)                                                      \
+    void on_adapter(const std::string& name, ov::ValueAccessor<T>& adapter) override {     \
+        append(name, std::to_string(adapter.get()));                                       \
+    }
+#define CPU_QUERY_SIGNATURE_VECTOR(T)                                                                   \
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<T>>& adapter) override {     \
+        std::string value;                                                                              \
+        for (const auto& item : adapter.get()) {                                                        \
+            value += std::to_string(item);                                                              \
+            value += ',';                                                                               \
+        }                                                                                               \
+        append(name, value);                                                                            \
+    }
+
+    CPU_QUERY_SIGNATURE_SCALAR(int8_t)
+    CPU_QUERY_SIGNATURE_SCALAR(int16_t)
+    CPU_QUERY_SIGNATURE_SCALAR(int32_t)
+    CPU_QUERY_SIGNATURE_SCALAR(int64_t)
+    CPU_QUERY_SIGNATURE_SCALAR(uint8_t)
+    CPU_QUERY_SIGNATURE_SCALAR(uint16_t)
+    CPU_QUERY_SIGNATURE_SCALAR(uint32_t)
+    CPU_QUERY_SIGNATURE_SCALAR(uint64_t)
+    CPU_QUERY_SIGNATURE_SCALAR(float)
+    CPU_QUERY_SIGNATURE_SCALAR(double)
+    CPU_QUERY_SIGNATURE_VECTOR(int8_t)
+    CPU_QUERY_SIGNATURE_VECTOR(int16_t)
+    CPU_QUERY_SIGNATURE_VECTOR(int32_t)
+    CPU_QUERY_SIGNATURE_VECTOR(int64_t)
+    CPU_QUERY_SIGNATURE_VECTOR(uint8_t)
+    CPU_QUERY_SIGNATURE_VECTOR(uint16_t)
+    CPU_QUERY_SIGNATURE_VECTOR(uint32_t)
+    CPU_QUERY_SIGNATURE_VECTOR(uint64_t)
+    CPU_QUERY_SIGNATURE_VECTOR(float)
+    CPU_QUERY_SIGNATURE_VECTOR(double)
+
+#undef CPU_QUERY_SIGNATURE_SCALAR
+#undef CPU_QUERY_SIGNATURE_VECTOR
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        std::string value;
+        for (const auto& item : adapter.get()) {
+            value += item;
+            value += ',';
+        }
+        append(name, value);
+    }
+
+    const std::string& signature() const { return m_signature; }
+    bool complete() const { return m_complete; }
+
+private:
+    void append(const std::string& name, const std::string& value) {
+        m_signature += '|';
+        m_signature += name;
+        m_signature += '=';
+        m_signature += value;
+    }
+
+    std::string m_signature;
+    bool m_complete = true;
+};
+
+// Node::factory().create() decides supportability from the op itself (type, attributes, I/O
+// precisions and shapes, and occasionally the values of small constant inputs such as axes),
+// not from the surrounding graph, so identical ops may share one verdict. Returns the signature
+// and whether it captures the op exactly.
+std::pair<std::string, bool> getQuerySignature(const std::shared_ptr<ngraph::Node>& op) {
+    std::ostringstream sig;
+    sig << op->get_type_info().name << '/' << (op->get_type_info().version_id ? op->get_type_info().version_id : "");
+    for (const auto& input : op->inputs()) {
+        sig << '|' << input.get_element_type() << input.get_partial_shape();
+        // small constant inputs (axes, pads, strides) may be read by the node constructor
+        constexpr size_t maxInlinedConstSize = 64lu;
+        if (auto constOp = ov::as_type<ov::op::v0::Constant>(input.get_source_output().get_node())) {
+            if (constOp->get_byte_size() <= maxInlinedConstSize) {
+                sig << '#';
+                sig.write(reinterpret_cast<const char*>(constOp->get_data_ptr()),
+                          static_cast<std::streamsize>(constOp->get_byte_size()));
+            }
+        }
+    }
+    for (const auto& output : op->outputs()) {
+        sig << '|' << output.get_element_type() << output.get_partial_shape();
+    }
+
+    NodeQuerySignatureVisitor visitor;
+    const bool visited = op->visit_attributes(visitor);
+    sig << visitor.signature();
+    return {sig.str(), visited && visitor.complete()};
+}
+}   // namespace
+
 QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::map<std::string, std::string>& config) const {
     WeightsSharing::Ptr fake_w_cache;
 
@@ -744,6 +896,10 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
     auto context =
         std::make_shared<GraphContext>(conf, extensionManager, fake_w_cache, false);
 
+    // verdicts for ops repeated across the model (the typical conv/eltwise blocks) are shared via
+    // their signature, so only the distinct ops pay for a trial node construction. The memo is
+    // per call on purpose: the verdicts depend on the effective config.
+    std::unordered_map<std::string, bool> verdicts;
     auto supported = GetSupportedNodes(model,
                                        [&](std::shared_ptr<ov::Model>& model) {
                                            Transformations transformation(model, enableLPT, conf.enforceBF16, isLegacyAPI(), snippetsMode, engConfig);
@@ -751,13 +907,22 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
                                            transformation.CpuSpecificOpSet();
                                        },
                                        [&](const std::shared_ptr<ngraph::Node>& op) {
+                                           auto signature = getQuerySignature(op);
+                                           if (signature.second) {
+                                               auto it = verdicts.find(signature.first);
+                                               if (it != verdicts.end())
+                                                   return it->second;
+                                           }
+                                           bool isSupported = true;
                                            std::unique_ptr<Node> ptr;
                                            try {
                                                ptr.reset(Node::factory().create(op, context));
                                            } catch (const InferenceEngine::Exception&) {
-                                               return false;
+                                               isSupported = false;
                                            }
-                                           return true;
+                                           if (signature.second)
+                                               verdicts.emplace(std::move(signature.first), isSupported);
+                                           return isSupported;
                                        });
 
     QueryNetworkResult res;
@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scratch_pad_arena.h"
+
+#include <algorithm>
+
+#include <common/utils.hpp>
+#include "ie_common.h"
+
+namespace ov {
+namespace intel_cpu {
+
+ScratchPadArena& ScratchPadArena::getInstance() {
+    static ScratchPadArena arena;
+    return arena;
+}
+
+ScratchPadArena::Block ScratchPadArena::checkout(size_t size) {
+    constexpr int cacheLineSize = 64;
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // best fit among the free blocks to keep the big ones for the big requests
+    auto best = m_freeBlocks.end();
+    for (auto it = m_freeBlocks.begin(); it != m_freeBlocks.end(); ++it) {
+        if (it->size >= size && (best == m_freeBlocks.end() || it->size < best->size))
+            best = it;
+    }
+
+    std::shared_ptr<void> data;
+    if (best != m_freeBlocks.end()) {
+        data = std::move(best->data);
+        size = best->size;
+        m_freeBlocks.erase(best);
+    } else {
+        void* ptr = dnnl::impl::malloc(size, cacheLineSize);
+        if (!ptr)
+            IE_THROW() << "Failed to allocate " << size << " bytes of scratch memory";
+        data = std::shared_ptr<void>(ptr, dnnl::impl::free);
+    }
+
+    Block block{data.get(), size};
+    m_checkedOut.emplace_back(block.data, std::move(data));
+    return block;
+}
+
+void ScratchPadArena::checkin(Block block) {
+    if (!block)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto owner = std::find_if(m_checkedOut.begin(),
+                              m_checkedOut.end(),
+                              [&](const std::pair<void*, std::shared_ptr<void>>& item) {
+                                  return item.first == block.data;
+                              });
+    if (owner == m_checkedOut.end())
+        return;
+
+    for (auto& freeBlock : m_freeBlocks)
+        freeBlock.idleCheckins++;
+
+    m_freeBlocks.push_back({std::move(owner->second), block.size, 0});
+    m_checkedOut.erase(owner);
+
+    evictLocked();
+}
+
+void ScratchPadArena::setRetainedCap(size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_retainedCap = bytes;
+    evictLocked();
+}
+
+void ScratchPadArena::evictLocked() {
+    // decayed blocks were not needed for many executions, the concurrency has dropped
+    m_freeBlocks.erase(std::remove_if(m_freeBlocks.begin(),
+                                      m_freeBlocks.end(),
+                                      [](const FreeBlock& freeBlock) {
+                                          return freeBlock.idleCheckins >= decayCheckins;
+                                      }),
+                       m_freeBlocks.end());
+
+    if (!m_retainedCap)
+        return;
+
+    size_t retained = 0;
+    for (const auto& freeBlock : m_freeBlocks)
+        retained += freeBlock.size;
+
+    // free the most idle blocks first until the free list fits under the cap
+    std::sort(m_freeBlocks.begin(), m_freeBlocks.end(), [](const FreeBlock& l, const FreeBlock& r) {
+        return l.idleCheckins < r.idleCheckins;
+    });
+    while (retained > m_retainedCap && !m_freeBlocks.empty()) {
+        retained -= m_freeBlocks.back().size;
+        m_freeBlocks.pop_back();
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
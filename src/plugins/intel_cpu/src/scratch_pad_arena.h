@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Process-wide pool of scratch buffers checked out for the duration of one Infer call.
+ *
+ * The number of simultaneously checked out blocks equals the number of streams actually
+ * inferring at the moment, so scratch memory scales with the used concurrency instead of
+ * the worst-case requirement multiplied by the stream count. Returned blocks are kept for
+ * reuse and decay away: a block that stays idle through enough checkins is freed.
+ *
+ * Is a thread safe
+ */
+class ScratchPadArena {
+public:
+    struct Block {
+        void* data = nullptr;
+        size_t size = 0;
+
+        explicit operator bool() const {
+            return data != nullptr;
+        }
+    };
+
+    static ScratchPadArena& getInstance();
+
+    /** Returns a block of at least `size` bytes, reusing a free one when possible */
+    Block checkout(size_t size);
+
+    /** Returns the block to the pool; may free decayed or over-the-cap blocks */
+    void checkin(Block block);
+
+    /** Caps the total bytes retained in the free list (0 means no cap) */
+    void setRetainedCap(size_t bytes);
+
+private:
+    ScratchPadArena() = default;
+
+    struct FreeBlock {
+        std::shared_ptr<void> data;
+        size_t size = 0;
+        int idleCheckins = 0;
+    };
+
+    void evictLocked();
+
+    // a block surviving this many checkins without reuse is considered over-provisioned
+    static constexpr int decayCheckins = 128;
+
+    std::mutex m_mutex;
+    std::vector<FreeBlock> m_freeBlocks;
+    std::vector<std::pair<void*, std::shared_ptr<void>>> m_checkedOut;
+    size_t m_retainedCap = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
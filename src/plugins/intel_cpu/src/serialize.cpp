@@ -144,6 +144,12 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     }
 
     // read blob content
+    // The weights section is copied out of the stream although the blob layout (see
+    // StreamSerialize::DataHeader) would allow mapping it straight from the cache file.
+    // The plugin API hands us only an std::istream, which neither reveals the backing
+    // file nor lets the weights outlive it, so aliasing the section would dangle once
+    // the caller closes the stream. Zero-copy import needs an ownership-carrying buffer
+    // in the ImportNetwork contract first; until then this copy is the import cost.
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
         dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "masked_softmax.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::MaskedSoftmaxNode::MaskedSoftmaxNode(const ngraph::Output<ngraph::Node>& data,
+                                                    const ngraph::Output<ngraph::Node>& mask,
+                                                    size_t axis)
+    : Op({data, mask}), m_axis(axis) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::MaskedSoftmaxNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(MaskedSoftmaxNode_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::MaskedSoftmaxNode>(new_args.at(0), new_args.at(1), m_axis);
+}
+
+void ov::intel_cpu::MaskedSoftmaxNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(MaskedSoftmaxNode_validate_and_infer_types);
+    const auto& data_pshape = get_input_partial_shape(0);
+    const auto& mask_pshape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+        data_pshape.rank().is_static() && mask_pshape.rank().is_static() &&
+        data_pshape.rank() == mask_pshape.rank(),
+        "data and mask must have equal static ranks");
+    NODE_VALIDATION_CHECK(this,
+        m_axis + 1 == static_cast<size_t>(data_pshape.rank().get_length()),
+        "only the innermost softmax axis is supported");
+    set_output_type(0, get_input_element_type(0), data_pshape);
+}
+
+bool ov::intel_cpu::MaskedSoftmaxNode::visit_attributes(ngraph::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(MaskedSoftmaxNode_visit_attributes);
+    visitor.on_attribute("axis", m_axis);
+    return true;
+}
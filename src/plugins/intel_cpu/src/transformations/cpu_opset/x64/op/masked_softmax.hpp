@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+class MaskedSoftmaxNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("MaskedSoftmax", "cpu_plugin_opset");
+
+    MaskedSoftmaxNode() = default;
+
+    MaskedSoftmaxNode(const ngraph::Output<ngraph::Node>& data,
+                      const ngraph::Output<ngraph::Node>& mask,
+                      size_t axis);
+
+    bool visit_attributes(ngraph::AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+
+    size_t get_axis() const { return m_axis; }
+
+private:
+    size_t m_axis = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "masked_softmax_fusion.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include "transformations/cpu_opset/x64/op/masked_softmax.hpp"
+
+#include "itt.hpp"
+
+ov::intel_cpu::MaskedSoftmaxFusion::MaskedSoftmaxFusion() {
+    MATCHER_SCOPE(MaskedSoftmaxFusion);
+    auto add_m = ngraph::pattern::wrap_type<ngraph::opset1::Add>({ngraph::pattern::any_input(), ngraph::pattern::any_input()},
+                                                                 ngraph::pattern::consumers_count(1));
+    auto softmax_m = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>({add_m});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto softmax = m.get_match_root();
+        auto add = std::dynamic_pointer_cast<ngraph::opset1::Add>(softmax->get_input_node_shared_ptr(0));
+        if (!add) {
+            return false;
+        }
+
+        const auto& out_pshape = add->get_output_partial_shape(0);
+        if (out_pshape.rank().is_dynamic()) {
+            return false;
+        }
+        const auto rank = out_pshape.rank().get_length();
+
+        int64_t axis;
+        if (auto softmax_v8 = std::dynamic_pointer_cast<ngraph::opset8::Softmax>(softmax)) {
+            axis = softmax_v8->get_axis();
+            if (axis < 0)
+                axis += rank;
+        } else if (auto softmax_v1 = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(softmax)) {
+            axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else {
+            return false;
+        }
+        // the fused kernel is a row sweep over the innermost dimension
+        if (axis != rank - 1) {
+            return false;
+        }
+
+        const auto prc = softmax->get_output_element_type(0);
+        if (prc != ngraph::element::f32 && prc != ngraph::element::bf16) {
+            return false;
+        }
+
+        // the input carrying the full shape is the data, the other one is the mask
+        size_t data_idx;
+        if (add->get_input_partial_shape(0).same_scheme(out_pshape)) {
+            data_idx = 0;
+        } else if (add->get_input_partial_shape(1).same_scheme(out_pshape)) {
+            data_idx = 1;
+        } else {
+            return false;
+        }
+        const size_t mask_idx = 1 - data_idx;
+
+        // the mask may broadcast over the outer dimensions, but must cover the full row
+        const auto& mask_pshape = add->get_input_partial_shape(mask_idx);
+        if (mask_pshape.rank().is_dynamic() || mask_pshape.rank().get_length() != rank) {
+            return false;
+        }
+        const auto& mask_last = mask_pshape[rank - 1];
+        const auto& out_last = out_pshape[rank - 1];
+        if (!mask_last.is_static() || !out_last.is_static() || mask_last.get_length() != out_last.get_length()) {
+            return false;
+        }
+
+        const auto maskedSoftmax = std::make_shared<ov::intel_cpu::MaskedSoftmaxNode>(add->input_value(data_idx),
+                                                                                      add->input_value(mask_idx),
+                                                                                      static_cast<size_t>(axis));
+        maskedSoftmax->set_friendly_name(softmax->get_friendly_name());
+        ngraph::copy_runtime_info({add, softmax}, maskedSoftmax);
+        ngraph::replace_node(softmax, maskedSoftmax);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(softmax_m, matcher_name);
+    this->register_matcher(m, callback);
+}
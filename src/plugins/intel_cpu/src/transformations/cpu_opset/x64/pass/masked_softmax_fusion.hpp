@@ -0,0 +1,19 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+class MaskedSoftmaxFusion : public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MaskedSoftmaxFusion", "0");
+    MaskedSoftmaxFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -95,6 +95,7 @@
 #include "transformations/cpu_opset/convert_to_cpu_specific_opset.hpp"
 #include "transformations/snippets/x64/pass/snippets_mark_skipped.hpp"
 #include "transformations/cpu_opset/x64/pass/mha_fusion.hpp"
+#include "transformations/cpu_opset/x64/pass/masked_softmax_fusion.hpp"
 #include "transformations/cpu_opset/x64/pass/convert_to_interaction.hpp"
 #include "transformations/cpu_opset/arm/pass/convert_group_conv.hpp"
 #include "transformations/cpu_opset/arm/pass/convert_group_conv1d.hpp"
@@ -578,6 +579,8 @@ void Transformations::PostLpt() {
 
     // Snippets may brake MHA patterns so the fusion has to performed before
     CPU_REGISTER_PASS_X64(postLPTPassManager, MHAFusion);
+    // MaskedSoftmaxFusion picks up the Add+Softmax pairs the MHA pattern left behind
+    CPU_REGISTER_PASS_X64(postLPTPassManager, MaskedSoftmaxFusion);
     CPU_REGISTER_PASS_X64(postLPTPassManager, FuseFQtoInteraction);
 
     CPU_SET_CALLBACK_X64(postLPTPassManager,
@@ -76,6 +76,11 @@ NumaNodesWeights::NumaNodesWeights() {
         _cache_map[numa_id] = std::make_shared<WeightsSharing>();
 }
 
+NumaNodesWeights& NumaNodesWeights::getProcessShared() {
+    static NumaNodesWeights sharedWeights;
+    return sharedWeights;
+}
+
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
@@ -114,6 +114,9 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    /** Process-wide collection shared by all compiled models (see Config::sharedWeightsCache) */
+    static NumaNodesWeights& getProcessShared();
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
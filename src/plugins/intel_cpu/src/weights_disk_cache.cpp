@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "weights_disk_cache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "weights_cache.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+WeightsDiskCache::WeightsDiskCache(std::string dir) : m_dir(std::move(dir)) {}
+
+std::string WeightsDiskCache::makePath(const std::string& key) const {
+    // the key contains node names which may hold path separators, so file names are built from its hash
+    const uint64_t hash = WeightsSharing::GetHashFunc().hash(
+            reinterpret_cast<const unsigned char*>(key.data()), key.size());
+    return m_dir + "/" + std::to_string(hash) + ".cpu_weights";
+}
+
+MemoryPtr WeightsDiskCache::load(const std::string& key, const DnnlMemoryDescPtr& desc, const dnnl::engine& engine) const {
+    std::ifstream file(makePath(key), std::ios::binary | std::ios::ate);
+    if (!file)
+        return nullptr;
+
+    const auto payload_size = desc->getCurrentMemSize();
+    const auto file_size = static_cast<size_t>(file.tellg());
+    if (file_size != payload_size + sizeof(uint64_t))
+        return nullptr;  // stale or truncated entry, will be overwritten by store()
+
+    MemoryPtr memory = std::make_shared<Memory>(engine);
+    memory->Create(desc);
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(memory->GetData()), payload_size))
+        return nullptr;
+    uint64_t stored_checksum = 0;
+    if (!file.read(reinterpret_cast<char*>(&stored_checksum), sizeof(stored_checksum)))
+        return nullptr;
+    const uint64_t checksum = WeightsSharing::GetHashFunc().hash(
+            reinterpret_cast<const unsigned char*>(memory->GetData()), payload_size);
+    if (checksum != stored_checksum)
+        return nullptr;  // corrupted blob, store() will rewrite it
+    return memory;
+}
+
+void WeightsDiskCache::store(const std::string& key, const Memory& memory) const {
+    const auto path = makePath(key);
+    // the temporary name is unique per writer, so two processes compiling the same model
+    // never interleave writes into one file; the loser of the final rename merely replaces
+    // the winner's identical content
+    static std::atomic<uint64_t> tmp_counter{0};
+#ifdef _WIN32
+    const auto pid = _getpid();
+#else
+    const auto pid = getpid();
+#endif
+    const auto tmp_path = path + ".tmp." + std::to_string(pid) + "." + std::to_string(tmp_counter++);
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return;  // the cache directory is not writable, silently run without the disk cache
+        file.write(reinterpret_cast<const char*>(memory.GetData()), memory.GetSize());
+        // the checksum trailer lets load() reject blobs corrupted by a torn or interrupted write
+        const uint64_t checksum = WeightsSharing::GetHashFunc().hash(
+                reinterpret_cast<const unsigned char*>(memory.GetData()), memory.GetSize());
+        file.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+        if (!file) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return;
+        }
+    }
+    // the rename makes the entry visible atomically so a concurrent reader never sees a partial blob
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+        std::remove(tmp_path.c_str());
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
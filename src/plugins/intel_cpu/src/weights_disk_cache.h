@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "memory_desc/dnnl_memory_desc.h"
+
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Persistent store of reordered weights blobs.
+ *
+ * The model cache only skips the frontend and the transformations, so a warm
+ * process start still pays for every weights reorder. Entries are keyed by the
+ * same content-hash based string as WeightsSharing, thus a blob written by one
+ * process can be picked up by any other process compiling the same model.
+ *
+ * Is a thread safe (the atomic rename makes an entry visible only when fully written)
+ */
+class WeightsDiskCache {
+public:
+    typedef std::shared_ptr<WeightsDiskCache> Ptr;
+
+    explicit WeightsDiskCache(std::string dir);
+
+    /**
+     * Reads a previously stored blob for the key.
+     * Returns nullptr if there is no entry or its size does not match the desc.
+     */
+    MemoryPtr load(const std::string& key, const DnnlMemoryDescPtr& desc, const dnnl::engine& engine) const;
+
+    /** Stores the reordered blob under the key. I/O failures are silently ignored. */
+    void store(const std::string& key, const Memory& memory) const;
+
+private:
+    std::string makePath(const std::string& key) const;
+
+    std::string m_dir;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "workspace_sharing.h"
+
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+
+namespace ov {
+namespace intel_cpu {
+
+std::mutex WorkspaceSharing::mutex;
+std::map<std::string, MemoryPtr> WorkspaceSharing::workspaces;
+
+MemoryPtr WorkspaceSharing::getWorkspace(const std::string& domain, size_t size, const dnnl::engine& eng) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& workspace = workspaces[domain];
+    if (!workspace || workspace->GetSize() < size) {
+        // A workspace never grows in place: graphs bind raw offsets into it at allocation
+        // time, so a larger request gets a fresh buffer while previous requesters keep
+        // holding the one they were given.
+        workspace = std::make_shared<Memory>(eng);
+        workspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{size})));
+    }
+    return workspace;
+}
+
+}  // namespace intel_cpu
+}  // namespace ov
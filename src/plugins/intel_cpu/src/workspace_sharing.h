@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Process-wide registry of activation workspaces shared between compiled models.
+ *
+ * Models of a pipeline that never execute concurrently (e.g. a detector followed by a
+ * per-ROI classifier) can be compiled into the same named domain, so the pipeline holds
+ * one activation buffer sized to the largest stage instead of one buffer per stage.
+ * The registry is only a buffer store: callers are responsible for ensuring the sharing
+ * models do not run at the same time.
+ *
+ * Is thread safe
+ */
+class WorkspaceSharing {
+public:
+    /**
+     * Returns the workspace of the given domain if it can hold @p size bytes.
+     * Otherwise allocates a new workspace of @p size bytes and makes it the domain's
+     * current one; earlier requesters keep their (smaller) buffer alive through their
+     * own shared pointer, so compiling the largest stage first yields the best footprint.
+     */
+    static MemoryPtr getWorkspace(const std::string& domain, size_t size, const dnnl::engine& eng);
+
+private:
+    static std::mutex mutex;
+    static std::map<std::string, MemoryPtr> workspaces;
+};
+
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Minimal harness for opt-in microbenchmarks living inside the unit test binary.
+// Benchmarks are ordinary gtest cases which skip themselves unless OV_CPU_BENCHMARK
+// is set, so the default test run stays fast; results are printed as one JSON line
+// per measurement (and appended to the file named by OV_CPU_BENCHMARK_FILE when
+// set), which makes runs diffable against a stored baseline.
+//
+// A stored baseline turns the benchmarks into a regression gate: record one via
+// OV_CPU_BENCHMARK_FILE on a quiet machine, then point OV_CPU_BENCHMARK_BASELINE at
+// that file on later runs and measurements slower than the recorded ones beyond the
+// noise envelope fail the test (and with it the ctest run). Baselines are per
+// platform by construction - a file is only meaningful on the machine and frequency
+// settings it was recorded with.
+namespace benchutils {
+
+struct Stats {
+    double medianNs = 0.0;   // median iteration time after outlier rejection
+    double madNs = 0.0;      // median absolute deviation of the kept samples
+    size_t samples = 0;      // number of kept samples
+    size_t rejected = 0;     // number of samples dropped as outliers
+};
+
+inline bool enabled() {
+    return std::getenv("OV_CPU_BENCHMARK") != nullptr;
+}
+
+inline double median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    const size_t mid = values.size() / 2;
+    return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2;
+}
+
+// Runs the workload until timings settle, then collects sampleCount measurements and
+// rejects outliers farther than three (scaled) median absolute deviations from the
+// median, so a single preemption or frequency transition does not skew the result.
+inline Stats measure(const std::function<void()>& workload, size_t sampleCount = 50) {
+    using clock = std::chrono::steady_clock;
+    auto timeOnce = [&] {
+        const auto start = clock::now();
+        workload();
+        return std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(clock::now() - start).count();
+    };
+
+    // Warmup: done when the last five iterations agree with their median within 10%,
+    // or after a hard cap of 100 iterations for workloads that never settle
+    std::vector<double> window;
+    for (size_t i = 0; i < 100; ++i) {
+        window.push_back(timeOnce());
+        if (window.size() < 5)
+            continue;
+        window.erase(window.begin());
+        const double mid = median(window);
+        const bool settled = std::all_of(window.begin(), window.end(), [&](double t) {
+            return std::abs(t - mid) <= 0.1 * mid;
+        });
+        if (settled)
+            break;
+    }
+
+    std::vector<double> timings(sampleCount);
+    for (auto& t : timings)
+        t = timeOnce();
+
+    const double mid = median(timings);
+    std::vector<double> deviations(timings.size());
+    std::transform(timings.begin(), timings.end(), deviations.begin(), [&](double t) {
+        return std::abs(t - mid);
+    });
+    const double mad = median(deviations);
+    // 1.4826 scales MAD to the standard deviation of a normal distribution
+    const double threshold = 3 * 1.4826 * mad;
+
+    std::vector<double> kept;
+    for (double t : timings) {
+        if (mad == 0.0 || std::abs(t - mid) <= threshold)
+            kept.push_back(t);
+    }
+
+    Stats stats;
+    stats.medianNs = median(kept);
+    std::vector<double> keptDeviations(kept.size());
+    std::transform(kept.begin(), kept.end(), keptDeviations.begin(), [&](double t) {
+        return std::abs(t - stats.medianNs);
+    });
+    stats.madNs = median(keptDeviations);
+    stats.samples = kept.size();
+    stats.rejected = timings.size() - kept.size();
+    return stats;
+}
+
+struct CheckResult {
+    bool ok = true;
+    std::string message;
+};
+
+inline double parseField(const std::string& line, const std::string& field) {
+    const auto pos = line.find("\"" + field + "\":");
+    if (pos == std::string::npos)
+        return -1.0;
+    return std::atof(line.c_str() + pos + field.size() + 3);
+}
+
+// Compares a measurement with the entry recorded for the same name and parameters in
+// the file named by OV_CPU_BENCHMARK_BASELINE. The failure threshold combines a
+// relative tolerance (OV_CPU_BENCHMARK_TOLERANCE, default 15%) guarding fast
+// workloads against noise with a term built from the measured jitter of both runs,
+// so a result within the dispersion of either side is never flagged. Entries missing
+// from the baseline are reported but not gated, which lets new benchmarks land
+// before every platform has re-recorded its file.
+inline CheckResult checkAgainstBaseline(const std::string& name, const std::string& params, const Stats& stats) {
+    CheckResult result;
+    const char* path = std::getenv("OV_CPU_BENCHMARK_BASELINE");
+    if (!path)
+        return result;
+
+    const std::string prefix = "{\"name\":\"" + name + "\"," + params + ",";
+    std::ifstream file(path);
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.compare(0, prefix.size(), prefix) == 0)
+            break;
+        line.clear();
+    }
+    if (line.empty())
+        return result;
+
+    const double baseMedian = parseField(line, "median_ns");
+    const double baseMad = parseField(line, "mad_ns");
+    if (baseMedian <= 0.0)
+        return result;
+
+    double tolerance = 0.15;
+    if (const char* tol = std::getenv("OV_CPU_BENCHMARK_TOLERANCE"))
+        tolerance = std::atof(tol);
+
+    const double threshold = baseMedian + std::max(tolerance * baseMedian, 3 * 1.4826 * (baseMad + stats.madNs));
+    if (stats.medianNs > threshold) {
+        result.ok = false;
+        std::ostringstream msg;
+        msg << name << " {" << params << "}: median " << stats.medianNs << " ns exceeds baseline " << baseMedian
+            << " ns (allowed up to " << threshold << " ns)";
+        result.message = msg.str();
+    }
+    return result;
+}
+
+inline void report(const std::string& name, const std::string& params, const Stats& stats) {
+    std::ostringstream line;
+    line << "{\"name\":\"" << name << "\"," << params << ",\"median_ns\":" << stats.medianNs
+         << ",\"mad_ns\":" << stats.madNs << ",\"samples\":" << stats.samples << ",\"rejected\":" << stats.rejected
+         << "}";
+    std::cout << line.str() << std::endl;
+    if (const char* path = std::getenv("OV_CPU_BENCHMARK_FILE")) {
+        std::ofstream file(path, std::ios_base::app);
+        file << line.str() << '\n';
+    }
+}
+
+}  // namespace benchutils
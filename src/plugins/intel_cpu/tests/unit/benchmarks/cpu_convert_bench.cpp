@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+#include "bench_utils.hpp"
+#include "nodes/common/cpu_convert.h"
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+// Microbenchmark for the element-wise precision conversion kernels: sweeps buffer sizes
+// from cache-resident to memory-bound for the conversion pairs that dominate inference
+// input/output handling. Opt-in: set OV_CPU_BENCHMARK=1 to run, see bench_utils.hpp.
+TEST(CpuConvertBench, sizeAndPrecisionSweep) {
+    if (!benchutils::enabled())
+        GTEST_SKIP() << "set OV_CPU_BENCHMARK=1 to run microbenchmarks";
+
+    const std::vector<size_t> sizes = {1024, 16384, 262144, 4194304};
+    const std::vector<std::pair<Precision, Precision>> precisions = {
+        {Precision::FP32, Precision::BF16},
+        {Precision::BF16, Precision::FP32},
+        {Precision::FP32, Precision::FP16},
+        {Precision::FP32, Precision::I8},
+        {Precision::U8, Precision::FP32},
+        {Precision::I32, Precision::FP32},
+    };
+
+    for (const auto& precision : precisions) {
+        for (size_t size : sizes) {
+            std::vector<uint8_t> src(size * precision.first.size(), 1);
+            std::vector<uint8_t> dst(size * precision.second.size());
+
+            const auto stats = benchutils::measure([&] {
+                cpu_convert(src.data(), dst.data(), precision.first, precision.second, size);
+            });
+
+            std::ostringstream params;
+            params << "\"src\":\"" << precision.first.name() << "\",\"dst\":\"" << precision.second.name()
+                   << "\",\"size\":" << size;
+            benchutils::report("cpu_convert", params.str(), stats);
+
+            const auto check = benchutils::checkAgainstBaseline("cpu_convert", params.str(), stats);
+            EXPECT_TRUE(check.ok) << check.message;
+        }
+    }
+}
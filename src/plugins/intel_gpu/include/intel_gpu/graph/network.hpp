@@ -19,6 +19,7 @@
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <mutex>
 #include <list>
 #include <set>
 
@@ -180,6 +181,11 @@ public:
     std::vector<primitive_id> get_all_primitive_ids() const;
     std::vector<primitive_id> get_all_primitive_org_ids() const;
     const program::primitives_info& get_primitives_info() const;
+    /// @brief Returns size and allocation type of each primitive's output buffer.
+    /// Only inspects already allocated memory objects, so it's cheap enough to be queried at any time
+    /// and doesn't require profiling to be enabled. Note that the same underlying buffer may back
+    /// several primitives when the memory pool reuses allocations.
+    std::map<primitive_id, std::pair<uint64_t, allocation_type>> get_primitives_memory_usage() const;
     const program::graph_optimizer_info& get_optimizer_passes_info() const;
     std::map<primitive_id, primitive_id> get_ext_id_mapping() const;
     void execute_impl(const std::vector<event::ptr>& events);
@@ -227,6 +233,13 @@ public:
 
     const ExecutionConfig& get_config() const { return _config; }
 
+    /// Stores the first error thrown by a host-offloaded primitive of the current execution
+    void store_host_task_error(std::exception_ptr err);
+
+    /// Rethrows the stored host-task error, if any. Must be called after the execution's events
+    /// are complete, since a host task records its error before setting its completion event.
+    void rethrow_host_task_error();
+
 private:
     using output_chains_map = std::map<primitive_id, std::vector<std::shared_ptr<primitive_inst>>>;
     uint32_t net_id = 0;
@@ -241,6 +254,9 @@ private:
     bool _enable_profiling = false;
     bool _reset_arguments;
 
+    std::mutex _host_task_error_mutex;
+    std::exception_ptr _host_task_error = nullptr;
+
     std::unordered_map<primitive_id, std::shared_ptr<primitive_inst>> _primitives;
     std::vector<shared_mem_type> _in_out_shared_mem_types;
     std::vector<std::shared_ptr<primitive_inst>> _inputs;
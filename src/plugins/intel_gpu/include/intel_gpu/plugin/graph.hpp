@@ -115,6 +115,7 @@ protected:
 
     std::shared_ptr<cldnn::network> BuildNetwork(std::shared_ptr<cldnn::program> program);
     void Build();
+    void WarmUpShapes(const std::string& shapes_str);
     void UpdateLayersMaps();
     std::shared_ptr<ngraph::Function> GetExecGraphInfoByPrimitivesInfo(std::vector<cldnn::primitive_info>& pi,
                                                                        bool filter_const_primitives = true);
@@ -50,6 +50,7 @@ public:
     void enqueue_notify();
     void wait_notify();
 
+    void stage_inputs();
     void enqueue();
     void wait();
 
@@ -102,6 +103,10 @@ private:
 
     std::map<cldnn::primitive_id, cldnn::network_output> internal_outputs;
     Graph::variable_states_map variables_states_;
+
+    // side queue used to stage input copies while previous requests are still executing
+    cldnn::stream::ptr m_copy_stream = nullptr;
+    std::map<std::string, cldnn::event::ptr> staged_input_events;
 };
 
 }  // namespace intel_gpu
@@ -47,6 +47,13 @@ static constexpr Property<bool, PropertyMutability::RW> allow_static_input_reord
 static constexpr Property<bool, PropertyMutability::RW> partial_build_program{"GPU_PARTIAL_BUILD"};
 static constexpr Property<bool, PropertyMutability::RW> allow_new_shape_infer{"GPU_ALLOW_NEW_SHAPE_INFER"};
 static constexpr Property<bool, PropertyMutability::RW> use_only_static_kernels_for_dynamic_shape{"GPU_USE_ONLY_STATIC_KERNELS_FOR_DYNAMIC_SHAPE"};
+
+/**
+ * @brief Lists input shapes a dynamic model is warmed up with at load time, so the matching
+ * shape-specialized kernels are compiled and cached before the first real inference.
+ * Format: shape sets separated by '|', inputs within a set by ';', e.g. "data:1,3,224,224|data:8,3,224,224"
+ */
+static constexpr Property<std::string, PropertyMutability::RW> warmup_shapes{"GPU_WARMUP_SHAPES"};
 static constexpr Property<std::string, PropertyMutability::RW> dump_graphs{"GPU_DUMP_GRAPHS"};
 static constexpr Property<std::vector<std::string>, PropertyMutability::RW> custom_outputs{"GPU_CUSTOM_OUTPUTS"};
 static constexpr Property<ImplForcingMap, PropertyMutability::RW> force_implementations{"GPU_FORCE_IMPLEMENTATIONS"};
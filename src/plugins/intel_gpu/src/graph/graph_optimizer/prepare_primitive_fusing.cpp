@@ -38,6 +38,7 @@
 #include "space_to_batch_inst.h"
 #include "strided_slice_inst.h"
 #include "cum_sum_inst.h"
+#include "convert_color_inst.h"
 #include "embedding_bag_inst.h"
 #include "extract_image_patches_inst.h"
 #include "reduce_inst.h"
@@ -776,6 +777,8 @@ void prepare_primitive_fusing::fuse_simple_primitives(program &p) {
 
             should_fuse |= input.is_type<strided_slice>();
 
+            should_fuse |= input.is_type<convert_color>();
+
             bool legacy_fusion = activation_node.get_dependencies().size() == 1 &&
                                  !input.can_be_optimized() &&
                                  !activation_node.is_constant() &&
@@ -967,6 +970,7 @@ void prepare_primitive_fusing::fuse_simple_primitives(program &p) {
                                       (parents[i].first->is_type<gather>()) ||
                                       (parents[i].first->is_type<reduce>() &&
                                        reduce_supports_fusings(parents[i].first->as<reduce>())) ||
+                                      (parents[i].first->is_type<convert_color>()) ||
                                       (parents[i].first->is_type<lrn>());
             }
 
@@ -290,6 +290,17 @@ protected:
 
     mutable LruCache<layout, memory::ptr, layout::Hasher> _reordered_weights_cache;
 
+    // Ready-to-run implementations of this instance retired on shape change, keyed by impl params hash.
+    // The program-level implementations cache shares impls between instances, so even a hit there pays
+    // a clone per shape switch; entries here keep the clones made by this instance (with their kernels
+    // already set), so a repeating shape swaps the implementation back in with no preparation at all.
+    std::unordered_map<size_t, std::unique_ptr<primitive_impl>> _impls_local_cache;
+    // params hash the current _impl was prepared for; 0 means the impl is not cacheable
+    // (e.g. a shape agnostic fallback which may be superseded by an async compiled kernel)
+    size_t _impl_key = 0;
+
+    void retire_impl();
+
     // Buffer to store actual shapes of dynamic tensor which is automatically asigned as 1st argument to shape agnostic kernels
     memory::ptr _shape_info_memory = nullptr;
 
@@ -697,6 +697,21 @@ void network::set_arguments() {
     _reset_arguments = false;
 }
 
+void network::store_host_task_error(std::exception_ptr err) {
+    std::lock_guard<std::mutex> lock(_host_task_error_mutex);
+    if (!_host_task_error)
+        _host_task_error = err;
+}
+
+void network::rethrow_host_task_error() {
+    std::lock_guard<std::mutex> lock(_host_task_error_mutex);
+    if (_host_task_error) {
+        auto err = _host_task_error;
+        _host_task_error = nullptr;
+        std::rethrow_exception(err);
+    }
+}
+
 void network::reset_execution(bool wait) {
     if (wait) {
         auto queue_type = get_config().get_property(ov::intel_gpu::queue_type);
@@ -714,6 +729,9 @@ void network::reset_execution(bool wait) {
 
             get_stream().wait_for_events(events);
         }
+        // host tasks record their error before setting the completion event, so after the wait
+        // above any failure of the just-finished execution is visible and attributed to it
+        rethrow_host_task_error();
     }
     _events.clear();
 }
@@ -1314,6 +1332,18 @@ const program::primitives_info& network::get_primitives_info() const {
     return (_program == nullptr) ? _prims_info : _program->get_primitives_info();
 }
 
+std::map<primitive_id, std::pair<uint64_t, allocation_type>> network::get_primitives_memory_usage() const {
+    std::map<primitive_id, std::pair<uint64_t, allocation_type>> ret;
+    for (auto const& primitive : _primitives) {
+        const auto& inst = primitive.second;
+        if (!inst->outputs_allocated())
+            continue;
+        auto mem = inst->output_memory_ptr();
+        ret.emplace(inst->org_id(), std::make_pair(mem->size(), mem->get_allocation_type()));
+    }
+    return ret;
+}
+
 const program::graph_optimizer_info& network::get_optimizer_passes_info() const {
     return _program->get_optimizer_passes_info();
 }
@@ -1448,8 +1478,23 @@ void network::transfer_memory_to_device(std::shared_ptr<primitive_inst> instance
         return;
 
     if (alloc_type == allocation_type::usm_host || alloc_type == allocation_type::usm_shared) {
+        // Keep the constant in host USM when it doesn't fit into the remaining device memory:
+        // direct host access by the kernels is slower, but lets the model run at all
+        auto used_mem = get_engine().get_used_device_memory(allocation_type::usm_device);
+        if (used_mem + inst_mem.get_layout().bytes_count() > get_engine().get_device_info().max_global_mem_size) {
+            GPU_DEBUG_INFO << "[" << node.id() << "] transfer is skipped: device memory is exhausted, "
+                           << "constant stays in " << alloc_type << " memory" << std::endl;
+            return;
+        }
         // Allocate and transfer memory
-        auto device_mem = inst_mem.get_engine()->allocate_memory(inst_mem.get_layout(), allocation_type::usm_device, false);
+        memory::ptr device_mem = nullptr;
+        try {
+            device_mem = inst_mem.get_engine()->allocate_memory(inst_mem.get_layout(), allocation_type::usm_device, false);
+        } catch (const std::exception&) {
+            GPU_DEBUG_INFO << "[" << node.id() << "] transfer is skipped: device allocation failed, "
+                           << "constant stays in " << alloc_type << " memory" << std::endl;
+            return;
+        }
         device_mem->copy_from(get_stream(), inst_mem);
         GPU_DEBUG_LOG << "[" << node.id() << ": constant]" << std::endl;
         _memory_pool->release_memory(&inst_mem, node.id(), get_id());
@@ -300,6 +300,10 @@ event::ptr primitive_inst::realloc_if_needed() {
         GPU_DEBUG_TRACE_DETAIL << id() << ": realloc output memory. "
                                <<  " Current buffer_size=" << max_output_layout_size
                                <<  " Requested buffer_size=" << actual_layout.count() << std::endl;
+        // return the outgrown buffer to the pool, otherwise its record keeps the allocation
+        // alive for the whole network lifetime and the pool grows on every shape bump
+        if (_outputs[0] && _node->get_program().get_config().get_property(ov::intel_gpu::enable_memory_pool))
+            get_network().get_memory_pool().release_memory(_outputs[0].get(), id(), get_network_id());
         _outputs = allocate_outputs(&updated_params, need_reset_output_memory());
         // TODO : need to handle multiple outputs
         max_output_layout_size = updated_params.output_layouts[0].count();
@@ -331,6 +335,18 @@ event::ptr primitive_inst::realloc_if_needed() {
     return ev;
 }
 
+void primitive_inst::retire_impl() {
+    if (_impl == nullptr || _impl_key == 0)
+        return;
+    // Keep just a handful of entries: the target scenario is a small set of alternating shapes,
+    // while unbounded growth on a truly dynamic workload would pin kernels for the network lifetime
+    constexpr size_t max_local_impls = 4;
+    if (_impls_local_cache.size() >= max_local_impls)
+        _impls_local_cache.erase(_impls_local_cache.begin());
+    _impls_local_cache[_impl_key] = std::move(_impl);
+    _impl_key = 0;
+}
+
 bool primitive_inst::update_impl() {
     GPU_DEBUG_PROFILED_STAGE(instrumentation::pipeline_stage::update_implementation);
     auto prev_impl_str =  _impl != nullptr ? _impl->get_kernel_name() : "nullptr";
@@ -416,11 +432,33 @@ bool primitive_inst::update_impl() {
         }
 
         auto& cache = get_network().get_program()->get_implementations_cache();
+        const auto impl_key = updated_params.hash();
+        {
+            // A shape this instance has already executed gives back its own fully prepared impl
+            // (kernels and dispatch data set) without even a clone from the shared cache.
+            // Keyed by the params hash, same as the compilation context tasks.
+            auto local_it = _impls_local_cache.find(impl_key);
+            if (local_it != _impls_local_cache.end()) {
+                // take the cached impl out before retire_impl(): retiring inserts the current
+                // impl into the same map, which may rehash and invalidate local_it
+                auto cached_local_impl = std::move(local_it->second);
+                _impls_local_cache.erase(local_it);
+                retire_impl();
+                _impl = std::move(cached_local_impl);
+                _impl_key = impl_key;
+                GPU_DEBUG_PROFILED_STAGE_CACHE_HIT(true);
+                GPU_DEBUG_TRACE_DETAIL << id() << ": reuse local impl " << _impl->get_kernel_name() << std::endl;
+                reset_shape_change();
+                return true;
+            }
+        }
         std::shared_ptr<primitive_impl> cached_impl = nullptr;
         {
             cached_impl = cache.get(updated_params);
             if (cached_impl) {
+                retire_impl();
                 _impl = cached_impl->clone();
+                _impl_key = impl_key;
                 GPU_DEBUG_PROFILED_STAGE_CACHE_HIT(true);
                 GPU_DEBUG_TRACE_DETAIL << id() << ": get impl from cache " << _impl->get_kernel_name() << std::endl;
             // impl is not replaced
@@ -458,6 +496,9 @@ bool primitive_inst::update_impl() {
                     cache.add(updated_params_no_dyn_pad, impl->clone());
                 });
                 if (!can_be_optimized())  {
+                    retire_impl();
+                    // shape agnostic fallback is not worth keeping per shape: it may be superseded
+                    // by the async compiled kernel, so leave _impl_key at the non-cacheable zero
                     _impl = _dynamic_impl->clone();
                     auto new_impl_params = _impl->canonicalize_shapes(*_impl_params);
                     _impl->update_dispatch_data(new_impl_params);
@@ -465,12 +506,14 @@ bool primitive_inst::update_impl() {
                     update_shape_info(new_impl_params);
                 }
             } else {
+                retire_impl();
                 _impl = _node->type()->choose_impl(*_node, updated_params);
                 if (!can_be_optimized()) {
                     auto& kernels_cache = get_network().get_program()->get_kernels_cache();
                     auto kernels = kernels_cache.compile(updated_params, _impl->get_kernels_source());
                     _impl->set_kernels(kernels);
                 }
+                _impl_key = impl_key;
                 cache.add(updated_params, _impl->clone());
 
                 auto new_impl_str = _impl != nullptr ? _impl->get_kernel_name() : "nullptr";
@@ -575,6 +618,29 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
 
     {
         GPU_DEBUG_PROFILED_STAGE(instrumentation::pipeline_stage::inference);
+        // Host-implemented primitives (NMS, proposal, etc.) used to run on the submission thread,
+        // which stalled enqueueing of all the independent device work that follows them in the
+        // execution order. With an out-of-order queue every dependency is event based, so such a
+        // primitive can run on the program task executor while the device queue keeps being fed:
+        // consumers wait on the returned user event exactly as they would on a device event.
+        // Restricted to static top-level networks, since on the dynamic path the submission thread
+        // reads producer shapes/data during shape inference, and profiling needs device events.
+        auto& network = get_network();
+        if (_impl->is_cpu() && !network.is_dynamic() && !network.is_internal() &&
+            network.get_stream().get_queue_type() == QueueTypes::out_of_order &&
+            !network.get_config().get_property(ov::enable_profiling)) {
+            auto ev = network.get_stream().create_user_event(false);
+            network.get_program()->get_task_executor()->run([this, dependencies, ev]() {
+                try {
+                    _impl->execute(dependencies, *this);
+                } catch (...) {
+                    get_network().store_host_task_error(std::current_exception());
+                }
+                // the event must be set even on failure, otherwise the device queue deadlocks
+                ev->set();
+            });
+            return ev;
+        }
         auto ev = _impl->execute(dependencies, *this);
 
         GPU_DEBUG_IF(!debug_config->dump_profiling_data.empty()) {
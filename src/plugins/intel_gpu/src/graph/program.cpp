@@ -86,6 +86,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <stdio.h>
@@ -227,7 +228,22 @@ InferenceEngine::CPUStreamsExecutor::Config program::make_task_executor_config(c
 
 std::shared_ptr<InferenceEngine::CPUStreamsExecutor> program::make_task_executor(const ExecutionConfig& config) const {
     InferenceEngine::CPUStreamsExecutor::Config task_executor_config = make_task_executor_config(config, "CPU Tasks executor for GPU plugin");
-    return std::make_shared<InferenceEngine::CPUStreamsExecutor>(task_executor_config);
+
+    // Executors with the same pool configuration are shared across all programs in the process,
+    // so concurrent model loads are scheduled on a single worker pool of ov::compilation_num_threads
+    // size instead of oversubscribing the host with a separate pool per model.
+    // weak_ptr tracking lets the pool be destroyed once the last program using it is gone
+    static std::mutex mutex;
+    static std::map<std::pair<int, int>, std::weak_ptr<InferenceEngine::CPUStreamsExecutor>> shared_executors;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto key = std::make_pair(task_executor_config._streams, static_cast<int>(task_executor_config._threadPreferredCoreType));
+    auto& weak_executor = shared_executors[key];
+    auto executor = weak_executor.lock();
+    if (!executor) {
+        executor = std::make_shared<InferenceEngine::CPUStreamsExecutor>(task_executor_config);
+        weak_executor = executor;
+    }
+    return executor;
 }
 
 kernels_cache& program::get_kernels_cache() const {
@@ -651,8 +667,24 @@ void program::transfer_memory_to_device() {
 
             if (alloc_type == allocation_type::usm_host || alloc_type == allocation_type::usm_shared) {
                 GPU_DEBUG_LOG << "[" << data_node.id() << ": constant]" << std::endl;
+                // If the device memory can't hold this constant, keep it in host USM: kernels can
+                // still read it directly over the host link, which trades bandwidth for the ability
+                // to run models whose weights don't fit into device memory
+                auto used_mem = get_engine().get_used_device_memory(allocation_type::usm_device);
+                if (used_mem + data_node_layout.bytes_count() > get_engine().get_device_info().max_global_mem_size) {
+                    GPU_DEBUG_INFO << "[" << data_node.id() << "] transfer is skipped: device memory is exhausted, "
+                                   << "constant stays in " << alloc_type << " memory" << std::endl;
+                    continue;
+                }
                 // Allocate and transfer memory
-                auto device_mem = mem.get_engine()->allocate_memory(data_node_layout, allocation_type::usm_device, false);
+                memory::ptr device_mem = nullptr;
+                try {
+                    device_mem = mem.get_engine()->allocate_memory(data_node_layout, allocation_type::usm_device, false);
+                } catch (const std::exception&) {
+                    GPU_DEBUG_INFO << "[" << data_node.id() << "] transfer is skipped: device allocation failed, "
+                                   << "constant stays in " << alloc_type << " memory" << std::endl;
+                    continue;
+                }
                 device_mem->copy_from(get_stream(), mem);
                 data_node.attach_memory(device_mem);
                 GPU_DEBUG_LOG << "[" << data_node.id() << ": constant]" << std::endl;
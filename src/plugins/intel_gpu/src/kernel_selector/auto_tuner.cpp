@@ -189,7 +189,20 @@ TuningCache* TuningCache::get() {
     static std::mutex m;
     static std::shared_ptr<TuningCache> cache_instance = nullptr;
     std::lock_guard<std::mutex> lock(m);
-    std::string path = "cache.json";
+    // a tuning file generated for the target device and shapes may be plugged in without
+    // rebuilding the plugin; otherwise the cache shipped next to the library is used
+    std::string path = GetStringEnv("OV_GPU_TUNING_CACHE_PATH");
+    if (!path.empty()) {
+        if (!cache_instance) {
+            try {
+                cache_instance = std::make_shared<kernel_selector::TuningCache>(path);
+            } catch (...) {
+                cache_instance = std::make_shared<kernel_selector::TuningCache>();
+            }
+        }
+        return cache_instance.get();
+    }
+    path = "cache.json";
 #ifdef _WIN32
     char module_path[MAX_PATH];
     HMODULE hm = NULL;
@@ -13,7 +13,11 @@ KERNEL(convert_color_ref)(const __global INPUT0_TYPE* input1,
                           const __global INPUT2_TYPE* input3,
 #endif
 #endif
-                          __global OUTPUT_TYPE* output) {
+                          __global OUTPUT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+                          , FUSED_OPS_DECLS
+#endif
+) {
 
     const uint b = get_global_id(0);
     const uint y = get_global_id(1);
@@ -53,13 +57,22 @@ KERNEL(convert_color_ref)(const __global INPUT0_TYPE* input1,
 #endif
 
 #ifdef CONVERT_TO_RGB
-    output[OUTPUT_GET_INDEX(b, 0, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(R), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 1, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(G), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 2, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(B), ACTIVATION_PARAMS);
+    float ch0 = R; float ch1 = G; float ch2 = B;
 #else // BGR
-    output[OUTPUT_GET_INDEX(b, 0, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(B), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 1, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(G), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 2, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(R), ACTIVATION_PARAMS);
+    float ch0 = B; float ch1 = G; float ch2 = R;
+#endif
+
+#if HAS_FUSED_OPS
+    FUSED_OPS_F0;
+    output[OUTPUT_GET_INDEX(b, 0, y, x)] = FUSED_OPS_RESULT_F0;
+    FUSED_OPS_F1;
+    output[OUTPUT_GET_INDEX(b, 1, y, x)] = FUSED_OPS_RESULT_F1;
+    FUSED_OPS_F2;
+    output[OUTPUT_GET_INDEX(b, 2, y, x)] = FUSED_OPS_RESULT_F2;
+#else
+    output[OUTPUT_GET_INDEX(b, 0, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(ch0), ACTIVATION_PARAMS);
+    output[OUTPUT_GET_INDEX(b, 1, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(ch1), ACTIVATION_PARAMS);
+    output[OUTPUT_GET_INDEX(b, 2, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(ch2), ACTIVATION_PARAMS);
 #endif
 }
 #endif
@@ -73,7 +86,11 @@ KERNEL(convert_color_ref)(read_only image2d_t input1,
                           read_only image2d_t input3,
 #endif
 #endif
-                          __global OUTPUT_TYPE* output) {
+                          __global OUTPUT_TYPE* output
+#if HAS_FUSED_OPS_DECLS
+                          , FUSED_OPS_DECLS
+#endif
+) {
 
     const uint b = get_global_id(0);
     const uint y = get_global_id(1);
@@ -110,13 +127,22 @@ KERNEL(convert_color_ref)(read_only image2d_t input1,
 #endif
 
 #ifdef CONVERT_TO_RGB
-    output[OUTPUT_GET_INDEX(b, 0, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(R), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 1, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(G), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 2, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(B), ACTIVATION_PARAMS);
+    float ch0 = R; float ch1 = G; float ch2 = B;
 #else // BGR
-    output[OUTPUT_GET_INDEX(b, 0, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(B), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 1, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(G), ACTIVATION_PARAMS);
-    output[OUTPUT_GET_INDEX(b, 2, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(R), ACTIVATION_PARAMS);
+    float ch0 = B; float ch1 = G; float ch2 = R;
+#endif
+
+#if HAS_FUSED_OPS
+    FUSED_OPS_F0;
+    output[OUTPUT_GET_INDEX(b, 0, y, x)] = FUSED_OPS_RESULT_F0;
+    FUSED_OPS_F1;
+    output[OUTPUT_GET_INDEX(b, 1, y, x)] = FUSED_OPS_RESULT_F1;
+    FUSED_OPS_F2;
+    output[OUTPUT_GET_INDEX(b, 2, y, x)] = FUSED_OPS_RESULT_F2;
+#else
+    output[OUTPUT_GET_INDEX(b, 0, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(ch0), ACTIVATION_PARAMS);
+    output[OUTPUT_GET_INDEX(b, 1, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(ch1), ACTIVATION_PARAMS);
+    output[OUTPUT_GET_INDEX(b, 2, y, x)] = ACTIVATION(TO_OUTPUT_TYPE(ch2), ACTIVATION_PARAMS);
 #endif
 }
 #endif
@@ -5,7 +5,10 @@
 #include "intel_gpu/runtime/device.hpp"
 #include "kernel_base_opencl.h"
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 #include <memory>
 
@@ -86,6 +89,68 @@ std::string KernelBaseOpenCL::GetEntryPoint(const std::string& templateName,
 std::pair<std::string, std::string> KernelBaseOpenCL::CreateJit(const std::string& template_name,
                                           const JitConstants& constants,
                                           const std::string& kernel_id) const {
+    // The macro block generated from the jit constants (and the matching undefs) does not depend on
+    // the kernel_id - only the header macros below do - while models commonly instantiate many
+    // primitives with identical jit constant sets (the same conv config repeated across the
+    // network). Cache the generated block so repeated instantiations pay a single lookup instead of
+    // rebuilding the strings from scratch. The cache is process-wide since the kernel instances are
+    // static singletons and compilation runs on the task executor threads.
+    static std::mutex jit_cache_mutex;
+    static std::unordered_map<std::string, std::pair<std::string, std::string>> jit_cache;
+    constexpr size_t max_jit_cache_size = 512;
+
+    const auto definitions = constants.GetDefinitions();
+    std::string cache_key = template_name;
+    {
+        size_t key_size = cache_key.size();
+        for (const auto& definition : definitions)
+            key_size += definition.first.size() + definition.second.size() + 2;
+        cache_key.reserve(key_size);
+        for (const auto& definition : definitions) {
+            // separators that cannot occur in a macro name or value
+            cache_key += '\x01';
+            cache_key += definition.first;
+            cache_key += '\x02';
+            cache_key += definition.second;
+        }
+    }
+
+    // {macro definitions block, undefs block}
+    std::pair<std::string, std::string> def_block;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(jit_cache_mutex);
+        auto it = jit_cache.find(cache_key);
+        if (it != jit_cache.end()) {
+            def_block = it->second;
+            cached = true;
+        }
+    }
+
+    if (!cached) {
+        class CodeBuilder def_code;
+        std::string def_undefs;
+        for (auto& definition : definitions) {
+            def_code.value_macro(definition.first, definition.second);
+            if (definition.first.find("SIZES_DATA") != std::string::npos) {
+                auto size_arr_data = definition.first;
+                auto size_arr = size_arr_data.erase(size_arr_data.find("_DATA") , 5);
+                def_code.add_line("CONST_ARRAY_DECL(" + size_arr + ") = " + definition.first + ";");
+                def_code.value_macro(size_arr, "CONST_ARRAY_REF(" + size_arr + ")");
+            }
+
+            def_undefs += "#ifdef " + definition.first.substr(0, definition.first.find('(')) + "\n";
+            def_undefs += "#undef " + definition.first.substr(0, definition.first.find('(')) + "\n";
+            def_undefs += "#endif\n";
+        }
+        def_block = {def_code.str(), def_undefs};
+
+        std::lock_guard<std::mutex> lock(jit_cache_mutex);
+        if (jit_cache.size() >= max_jit_cache_size)
+            jit_cache.clear();
+        jit_cache.emplace(std::move(cache_key), def_block);
+    }
+
     class CodeBuilder code;
     std::string undefs;
     code.add_line("\n//====================================================")
@@ -102,22 +167,9 @@ std::pair<std::string, std::string> KernelBaseOpenCL::CreateJit(const std::strin
     undefs += "#undef FUNC_CALL\n";
     undefs += "#undef CONST_ARRAY_DECL\n";
     undefs += "#undef CONST_ARRAY_REF\n";
+    undefs += def_block.second;
 
-    for (auto& definition : constants.GetDefinitions()) {
-        code.value_macro(definition.first, definition.second);
-        if (definition.first.find("SIZES_DATA") != std::string::npos) {
-            auto size_arr_data = definition.first;
-            auto size_arr = size_arr_data.erase(size_arr_data.find("_DATA") , 5);
-            code.add_line("CONST_ARRAY_DECL(" + size_arr + ") = " + definition.first + ";");
-            code.value_macro(size_arr, "CONST_ARRAY_REF(" + size_arr + ")");
-        }
-
-        undefs += "#ifdef " + definition.first.substr(0, definition.first.find('(')) + "\n";
-        undefs += "#undef " + definition.first.substr(0, definition.first.find('(')) + "\n";
-        undefs += "#endif\n";
-    }
-
-    std::string jit = code.str();
+    std::string jit = code.str() + def_block.first;
     std::pair<std::string, std::string> jit_undefs(jit, undefs);
 
     return jit_undefs;
@@ -71,6 +71,15 @@ JitConstants ConvertColorKernelBase::GetJitConstants(const convert_color_params&
         default:
             IE_THROW() << "Not supported memory type";
     }
+
+    if (!params.fused_ops.empty()) {
+        // channel values are computed as floats and stored one by one, so each store gets its
+        // own fused ops entry with an explicit feature coordinate
+        FusedOpsConfiguration conf0 = {"_F0", {"b", "0", "y", "x"}, "ch0", Datatype::F32};
+        FusedOpsConfiguration conf1 = {"_F1", {"b", "1", "y", "x"}, "ch1", Datatype::F32};
+        FusedOpsConfiguration conf2 = {"_F2", {"b", "2", "y", "x"}, "ch2", Datatype::F32};
+        jit.Merge(MakeFusedOpsJitConstants(params, {conf0, conf1, conf2}));
+    }
     return jit;
 }
 
@@ -90,7 +99,7 @@ KernelsData ConvertColorKernelBase::GetCommonKernelsData(const Params& params, c
     auto& kernel = kd.kernels[0];
     uint32_t number_of_inputs = static_cast<uint32_t>(prim_params.inputs.size());
     FillCLKernelData(kernel, dispatchData, params.engineInfo, kernelName, jit, entry_point,
-                     "", false, false, number_of_inputs);
+                     "", false, false, number_of_inputs, GetFusedPrimitiveInputsCount(params));
 
     return { kd };
 }
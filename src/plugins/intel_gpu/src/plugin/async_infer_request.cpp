@@ -37,6 +37,10 @@ void AsyncInferRequest::StartAsync_ThreadUnsafe() {
     if (_inferRequest->use_external_queue()) {
         _inferRequest->setup_stream_graph();
         _inferRequest->enqueue_notify();
+    } else {
+        // issue input copies on the side queue right away, so they overlap with
+        // the requests which are still executing on the stream
+        _inferRequest->stage_inputs();
     }
     Parent::StartAsync_ThreadUnsafe();
 }
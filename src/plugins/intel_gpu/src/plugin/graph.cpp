@@ -166,6 +166,56 @@ void Graph::Build() {
         }
         net_id++;
     }
+
+    // the implementations cache is shared between the stream networks, so one stream warms up all
+    const auto& warmup_shapes = m_config.get_property(ov::intel_gpu::warmup_shapes);
+    if (!warmup_shapes.empty() && m_stream_id == 0 && GetNetwork()->is_dynamic()) {
+        WarmUpShapes(warmup_shapes);
+    }
+}
+
+void Graph::WarmUpShapes(const std::string& shapes_str) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "Graph::WarmUpShapes");
+    auto network = GetNetwork();
+    const auto& input_layouts = GetInputLayouts();
+
+    std::stringstream sets_stream(shapes_str);
+    std::string shape_set;
+    while (std::getline(sets_stream, shape_set, '|')) {
+        std::map<std::string, cldnn::layout> warmup_layouts;
+        std::stringstream set_stream(shape_set);
+        std::string entry;
+        while (std::getline(set_stream, entry, ';')) {
+            auto delim = entry.find(':');
+            OPENVINO_ASSERT(delim != std::string::npos, "[GPU] Invalid entry in warmup shapes list: ", entry);
+            auto name = entry.substr(0, delim);
+            auto base_layout = input_layouts.find(name);
+            OPENVINO_ASSERT(base_layout != input_layouts.end(), "[GPU] Unknown input in warmup shapes list: ", name);
+
+            std::vector<ov::Dimension> dims;
+            std::stringstream dims_stream(entry.substr(delim + 1));
+            std::string dim;
+            while (std::getline(dims_stream, dim, ','))
+                dims.emplace_back(std::stol(dim));
+
+            warmup_layouts.emplace(name, cldnn::layout(ov::PartialShape(dims),
+                                                       base_layout->second.data_type,
+                                                       base_layout->second.format));
+        }
+
+        // a shape set may turn out invalid for the model (e.g. data dependent shape inference
+        // over the zero filled buffers), in which case it is just skipped
+        try {
+            for (const auto& item : warmup_layouts) {
+                auto mem = get_engine().allocate_memory(item.second, true);
+                network->set_input_data("parameter:" + item.first, mem);
+            }
+            network->execute({});
+            network->get_stream().finish();
+        } catch (std::exception& ex) {
+            GPU_DEBUG_INFO << "Shape warmup failed for set '" << shape_set << "': " << ex.what() << std::endl;
+        }
+    }
 }
 
 bool Graph::use_external_queue() const {
@@ -221,6 +271,10 @@ std::shared_ptr<ngraph::Function> Graph::GetExecGraphInfoByPrimitivesInfo(std::v
 
     std::map<std::string, std::shared_ptr<ngraph::Node>> node2layer;
 
+    // runtime memory attribution is collected unconditionally as it only inspects
+    // the buffers which are already allocated for the network primitives
+    const auto mem_usage = GetNetwork()->get_primitives_memory_usage();
+
     ngraph::ResultVector results;
     ngraph::ParameterVector params;
     ngraph::NodeVector nodes;
@@ -431,6 +485,14 @@ std::shared_ptr<ngraph::Function> Graph::GetExecGraphInfoByPrimitivesInfo(std::v
         }
         info[ExecGraphInfoSerialization::PERF_COUNTER] = exec_time;
 
+        auto mem_it = mem_usage.find(prim_info.original_id);
+        if (mem_it != mem_usage.end()) {
+            std::ostringstream mem_type;
+            mem_type << mem_it->second.second;
+            info["outputMemorySize"] = std::to_string(mem_it->second.first);
+            info["outputMemoryType"] = mem_type.str();
+        }
+
         for (auto&& kvp : info) {
             return_node->get_rt_info()[kvp.first] = kvp.second;
             if (is_output)
@@ -417,6 +417,49 @@ void InferRequest::enqueue_notify() {
     enqueue();
 }
 
+void InferRequest::stage_inputs() {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "InferRequest::stage_inputs");
+    staged_input_events.clear();
+    // the very first inference allocates the device blobs, so there is nothing to stage yet
+    if (m_graph == nullptr || !m_graph->GetNetwork())
+        return;
+
+    for (auto& item : _inputs) {
+        const std::string& name = item.first;
+        const Blob::Ptr& inputBlob = item.second;
+        // batched inputs are merged into a fresh device blob during enqueue
+        if (inputTensorsMap.find(name) != inputTensorsMap.end())
+            continue;
+        if (inputBlob->is<gpu::ClBlob>())
+            continue;
+        // these precisions are converted element-wise on the regular path
+        const auto& prec = inputBlob->getTensorDesc().getPrecision();
+        if (prec == Precision::I16 || prec == Precision::U16 || prec == Precision::FP64 ||
+            prec == Precision::U64 || prec == Precision::U32)
+            continue;
+        auto layoutItr = m_graph->GetInputLayouts().find(name);
+        if (layoutItr == m_graph->GetInputLayouts().end() || layoutItr->second.is_dynamic())
+            continue;
+        auto blobItr = _deviceInputs.find(name);
+        if (blobItr == _deviceInputs.end() || blobItr->second->getTensorDesc() != inputBlob->getTensorDesc())
+            continue;
+        auto impl = getBlobImpl(blobItr->second->as<gpu::ClBlob>());
+        if (!impl->is_allocated())
+            continue;
+        auto inputMem = impl->get_memory();
+        auto src_lock = inputBlob->cbuffer();
+        auto src_ptr = src_lock.as<uint8_t*>();
+        if (same_host_mem(inputMem, src_ptr))
+            continue;
+
+        if (m_copy_stream == nullptr)
+            m_copy_stream = m_graph->get_engine().create_stream(m_graph->get_config());
+        staged_input_events[name] = inputMem->copy_from(*m_copy_stream, src_ptr, false);
+    }
+    if (!staged_input_events.empty())
+        m_copy_stream->flush();
+}
+
 void InferRequest::enqueue() {
     // set input and output memory from request blob maps
     // into the network object primitives
@@ -492,6 +535,17 @@ void InferRequest::enqueue() {
         prepare_output(outputName, outputBlob);
     }
 
+    if (!staged_input_events.empty()) {
+        // the execution queue is not implicitly ordered against the side queue,
+        // so sync on the staged copies before the network consumes the inputs
+        std::vector<cldnn::event::ptr> staged;
+        staged.reserve(staged_input_events.size());
+        for (auto& item : staged_input_events)
+            staged.push_back(item.second);
+        staged_input_events.clear();
+        networkPtr->get_stream().wait_for_events(staged);
+    }
+
     internal_outputs.clear();
     internal_outputs = networkPtr->execute(dependencies);
 
@@ -576,6 +630,10 @@ void InferRequest::wait() {
         }
     }
 
+    // all output events are complete at this point, so a failure of a host-offloaded primitive
+    // of this inference is already recorded and must be reported for this request, not the next one
+    m_graph->GetNetwork()->rethrow_host_task_error();
+
     // finally collect profiling info
     if (m_useProfiling) {
         m_graph->UpdatePerfStatistics();
@@ -880,9 +938,17 @@ void InferRequest::allocate_dev_mem_if_needed(InferenceEngine::BlobMap& device_m
     if (!can_skip_allocation) {
         if (is_usm_host) {
             // For USM case we create host blob using custom USM host allocator
-            // and then create shared device blob on top of this buffer
-            device_mems[blob_name] = create_shared_device_blob(user_blob->getTensorDesc(), layout, user_blob->buffer().as<void*>());
-        } else if (need_lockable_mem) {
+            // and then create shared device blob on top of this buffer.
+            // Adoption of the user buffer is opportunistic: it may be unable to back the requested
+            // device layout (e.g. when it's smaller than the layout due to precision conversion on copy),
+            // so on failure fall back to a regular device blob and an explicit copy
+            try {
+                device_mems[blob_name] = create_shared_device_blob(user_blob->getTensorDesc(), layout, user_blob->buffer().as<void*>());
+                users_blobs_matching[blob_name] = user_blob;
+                return;
+            } catch (const std::exception&) {}
+        }
+        if (need_lockable_mem) {
             device_mems[blob_name] =
                 create_remote_blob<RemoteUSMbuffer>(user_blob->getTensorDesc(), layout, BlobType::BT_USM_HOST_INTERNAL);
         } else {
@@ -991,11 +1057,17 @@ void InferRequest::prepare_input(const cldnn::primitive_id& inputName, Blob::Ptr
                         convertAndCopy<uint32_t, int32_t>(inputBlob.get(), ptr.data());
                     }
                 } else {
-                    auto src_lock = inputBlob->cbuffer();
-                    auto src_ptr = src_lock.as<uint8_t*>();
-                    if (!same_host_mem(inputMem, src_ptr)) {
-                        auto ev = inputMem->copy_from(stream, src_ptr, false);
-                        dependencies.push_back(ev);
+                    auto staged = staged_input_events.find(inputName);
+                    if (staged != staged_input_events.end()) {
+                        // the copy was issued on the side queue ahead of time
+                        dependencies.push_back(staged->second);
+                    } else {
+                        auto src_lock = inputBlob->cbuffer();
+                        auto src_ptr = src_lock.as<uint8_t*>();
+                        if (!same_host_mem(inputMem, src_ptr)) {
+                            auto ev = inputMem->copy_from(stream, src_ptr, false);
+                            dependencies.push_back(ev);
+                        }
                     }
                 }
             }
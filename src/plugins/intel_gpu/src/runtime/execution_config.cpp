@@ -71,7 +71,8 @@ void ExecutionConfig::set_default() {
         std::make_tuple(ov::intel_gpu::force_implementations, ImplForcingMap{}),
         std::make_tuple(ov::intel_gpu::partial_build_program, false),
         std::make_tuple(ov::intel_gpu::allow_new_shape_infer, false),
-        std::make_tuple(ov::intel_gpu::use_only_static_kernels_for_dynamic_shape, false));
+        std::make_tuple(ov::intel_gpu::use_only_static_kernels_for_dynamic_shape, false),
+        std::make_tuple(ov::intel_gpu::warmup_shapes, ""));
 }
 
 void ExecutionConfig::register_property_impl(const std::pair<std::string, ov::Any>& property, PropertyVisibility visibility, BaseValidator::Ptr validator) {
@@ -197,7 +198,10 @@ void ExecutionConfig::apply_user_properties(const cldnn::device_info& info) {
         set_property(ov::intel_gpu::enable_lp_transformations(info.supports_imad || info.supports_immad));
     }
 
-    if (info.supports_immad) {
+    // onednn primitives rely on in-order semantics, so it stays the default on immad platforms,
+    // but an explicit user choice of the queue type is respected to let event based dependency
+    // tracking overlap independent primitives
+    if (info.supports_immad && !is_set_by_user(ov::intel_gpu::queue_type)) {
         set_property(ov::intel_gpu::queue_type(QueueTypes::in_order));
     }
 
@@ -69,10 +69,9 @@ std::string kernels_cache::get_cache_path() const {
 }
 
 bool kernels_cache::is_cache_enabled() const {
-    if (!_config.get_property(ov::intel_gpu::allow_new_shape_infer)) {
-        return false;
-    }
-
+    // The binary store is content addressed (hash covers sources, options, device and driver),
+    // so it is useful beyond the dynamic-shape flow: a static model missing the model-level
+    // blob cache still reuses the binaries of every batch shared with previously built programs
     return !_config.get_property(ov::cache_dir).empty();
 }
 
@@ -191,6 +190,25 @@ static std::vector<unsigned char> getProgramBinaries(cl::Program program) {
 void kernels_cache::build_batch(const engine& build_engine, const batch_program& batch, compiled_kernels& compiled_kernels) {
     OV_ITT_SCOPED_TASK(ov::intel_gpu::itt::domains::intel_gpu_plugin, "KernelsCache::build_batch");
 
+    // Concurrently loaded models may produce identical batches (the hash covers sources,
+    // options and target device). Serialize such builds process-wide: when the compiled
+    // kernels cache is enabled, the second build turns into a binary load instead of
+    // recompiling the same source in parallel. Stale map entries are just expired weak_ptrs
+    // and are small enough to keep
+    static std::mutex in_flight_mutex;
+    static std::map<size_t, std::weak_ptr<std::mutex>> in_flight_builds;
+    std::shared_ptr<std::mutex> batch_build_lock;
+    {
+        std::lock_guard<std::mutex> lock(in_flight_mutex);
+        auto& entry = in_flight_builds[batch.hash_value];
+        batch_build_lock = entry.lock();
+        if (!batch_build_lock) {
+            batch_build_lock = std::make_shared<std::mutex>();
+            entry = batch_build_lock;
+        }
+    }
+    std::lock_guard<std::mutex> batch_lock(*batch_build_lock);
+
     auto& cl_build_engine = dynamic_cast<const ocl::ocl_engine&>(build_engine);
 
     bool dump_sources = batch.dump_custom_program;
@@ -240,24 +258,42 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
     try {
         cl::vector<cl::Kernel> kernels;
 
+        // Identical batches coming from different models compiled in the same cl_context share
+        // one cl program: the registry below is keyed by (context, batch hash), so an A/B model
+        // family keeps a single driver-side copy of the code common to its members.
+        // Entries are weak - programs are kept alive by the kernels_cache instances using them
+        static std::mutex shared_programs_mutex;
+        static std::map<std::pair<void*, size_t>, std::weak_ptr<cl::Program>> shared_programs_registry;
+        const auto registry_key = std::make_pair(static_cast<void*>(cl_build_engine.get_cl_context().get()), batch.hash_value);
+
+        std::shared_ptr<cl::Program> program = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(shared_programs_mutex);
+            auto it = shared_programs_registry.find(registry_key);
+            if (it != shared_programs_registry.end())
+                program = it->second.lock();
+        }
+
         // Run compilation
-        if (precompiled_kernels.empty()) {
-            cl::Program program(cl_build_engine.get_cl_context(), batch.source);
+        if (program != nullptr) {
+            program->createKernels(&kernels);
+        } else if (precompiled_kernels.empty()) {
+            program = std::make_shared<cl::Program>(cl_build_engine.get_cl_context(), batch.source);
             {
                 OV_ITT_SCOPED_TASK(ov::intel_gpu::itt::domains::intel_gpu_plugin, "KernelsCache::BuildProgram::RunCompilation");
-                if (program.build({cl_build_engine.get_cl_device()}, batch.options.c_str()) != CL_SUCCESS)
+                if (program->build({cl_build_engine.get_cl_device()}, batch.options.c_str()) != CL_SUCCESS)
                     throw std::runtime_error("Failed in building program.");
             }
 
             if (dump_sources && dump_file.good()) {
                 dump_file << "\n/* Build Log:\n";
-                for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
+                for (auto& p : program->getBuildInfo<CL_PROGRAM_BUILD_LOG>())
                     dump_file << p.second << "\n";
 
                 dump_file << "*/\n";
             }
 
-            program.createKernels(&kernels);
+            program->createKernels(&kernels);
 
             if (is_cache_enabled()) {
                 // If kernels caching is enabled, then we save compiled bucket to binary file with name ${code_hash_value}.cl_cache
@@ -265,18 +301,24 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
                 // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
                 // compile time.
                 std::lock_guard<std::mutex> lock(cacheAccessMutex);
-                ov::util::save_binary(cached_bin_name, getProgramBinaries(program));
+                ov::util::save_binary(cached_bin_name, getProgramBinaries(*program));
             }
         } else {
-            cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
-            if (program.build({cl_build_engine.get_cl_device()}, batch.options.c_str()) != CL_SUCCESS)
+            program = std::make_shared<cl::Program>(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
+            if (program->build({cl_build_engine.get_cl_device()}, batch.options.c_str()) != CL_SUCCESS)
                 throw std::runtime_error("Failed in building program with a precompiled kernel.");
 
-            program.createKernels(&kernels);
+            program->createKernels(&kernels);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(shared_programs_mutex);
+            shared_programs_registry[registry_key] = program;
         }
 
         {
             std::lock_guard<std::mutex> lock(_mutex);
+            _shared_programs.push_back(program);
             for (auto& k : kernels) {
                 const auto& entry_point = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
                 const auto& iter = batch.entry_point_to_id.find(entry_point);
@@ -451,6 +493,7 @@ void kernels_cache::reset() {
     _kernels.clear();
     _kernels_code.clear();
     _kernel_batch_hash.clear();
+    _shared_programs.clear();
     _pending_compilation = false;
 }
 
@@ -85,6 +85,9 @@ private:
     std::unordered_map<std::string, kernel::ptr> _cached_kernels;
     std::vector<std::string> batch_header_str;
     std::unordered_map<kernel_impl_params, size_t, impl_hasher> _kernel_batch_hash;
+    // holds the cl programs this cache created or reused, so the process-wide program
+    // registry entries stay alive while any model still uses their kernels
+    std::vector<std::shared_ptr<cl::Program>> _shared_programs;
     void get_program_source(const kernels_code& kernels_source_code, std::vector<batch_program>*) const;
     void build_batch(const engine& build_engine, const batch_program& batch, compiled_kernels& compiled_kernels);
 
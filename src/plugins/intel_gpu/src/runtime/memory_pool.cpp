@@ -53,15 +53,18 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
     // check nonpadded pool first
     auto _layout = mem->get_layout();
     auto type = mem->get_allocation_type();
+    // the passed memory may be a reinterpreted view of the pooled allocation, so records are
+    // matched by the underlying buffer handle; a view is never larger than the record it came
+    // from, thus starting the search at the view size covers both the view and the original
+    const auto mem_handle = mem->get_internal_params().mem;
 
     {
-        auto range = _non_padded_pool.equal_range(_layout.bytes_count());
-        auto it = range.first;
+        auto it = _non_padded_pool.lower_bound(_layout.bytes_count());
 
-        while (it != range.second && it != _non_padded_pool.end()) {
+        while (it != _non_padded_pool.end()) {
             if (it->second._network_id == network_id &&
                 it->second._type == type &&
-                it->second._memory.get() == mem) {
+                it->second._memory->get_internal_params().mem == mem_handle) {
                 auto user_it = it->second._users.find({ id, network_id });
 
                 // normally there should be only one entry
@@ -81,14 +84,16 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
         }
     }
     {
-        auto itr = _padded_pool.find(_layout);
+        // a reinterpreted view may not share the layout the record is keyed with, so walk all
+        // the lists rather than looking the layout up
+        auto itr = _padded_pool.begin();
 
-        if (itr != _padded_pool.end()) {
+        while (itr != _padded_pool.end()) {
             auto& list = itr->second;
             auto list_itr = list.begin();
 
             while (list_itr != list.end()) {
-                if (list_itr->_memory.get() == mem &&
+                if (list_itr->_memory->get_internal_params().mem == mem_handle &&
                     list_itr->_network_id == network_id &&
                     list_itr->_type == type) {
                     auto user_it = list_itr->_users.find({ id, network_id });
@@ -102,16 +107,18 @@ void memory_pool::release_memory(memory* mem, const primitive_id& id, uint32_t n
                         list.erase(list_itr);
                     }
 
+                    if (list.empty()) {
+                        _padded_pool.erase(itr);
+                    }
+
                     //entry found and processed - so return
-                    break;
+                    return;
                 } else {
                     list_itr++;
                 }
             }
 
-            if (list.empty()) {
-                _padded_pool.erase(itr);
-            }
+            ++itr;
         }
     }
 }
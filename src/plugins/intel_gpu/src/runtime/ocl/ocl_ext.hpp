@@ -919,23 +919,23 @@ public:
     // Get methods returns original pointer allocated by openCL.
     void* get() const { return _usm_pointer->ptr(); }
 
-    void allocateHost(size_t size) {
+    void allocateHost(size_t size, cl_uint alignment = 0) {
         cl_int error = CL_SUCCESS;
-        _allocate(_usmHelper.allocate_host(nullptr, size, 0, &error));
+        _allocate(_usmHelper.allocate_host(nullptr, size, alignment, &error));
         if (error != CL_SUCCESS)
             detail::errHandler(error, "[CL_EXT] UsmHost in cl extensions constructor failed");
     }
 
-    void allocateShared(size_t size) {
+    void allocateShared(size_t size, cl_uint alignment = 0) {
         cl_int error = CL_SUCCESS;
-        _allocate(_usmHelper.allocate_shared(nullptr, size, 0, &error));
+        _allocate(_usmHelper.allocate_shared(nullptr, size, alignment, &error));
         if (error != CL_SUCCESS)
             detail::errHandler(error, "[CL_EXT] UsmShared in cl extensions constructor failed");
     }
 
-    void allocateDevice(size_t size) {
+    void allocateDevice(size_t size, cl_uint alignment = 0) {
         cl_int error = CL_SUCCESS;
-        _allocate(_usmHelper.allocate_device(nullptr, size, 0, &error));
+        _allocate(_usmHelper.allocate_device(nullptr, size, alignment, &error));
         if (error != CL_SUCCESS)
             detail::errHandler(error, "[CL_EXT] UsmDevice in cl extensions constructor failed");
     }
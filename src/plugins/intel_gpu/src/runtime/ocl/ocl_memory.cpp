@@ -346,15 +346,21 @@ gpu_usm::gpu_usm(ocl_engine* engine, const layout& layout, allocation_type type)
     , memory(engine, layout, type, false)
     , _buffer(engine->get_usm_helper())
     , _host_buffer(engine->get_usm_helper()) {
+    // Once a buffer spans at least one large page, ask the driver for 2 MiB aligned backing:
+    // this allows the allocation to be promoted to 2 MiB pages, which reduces page-table depth
+    // and TLB pressure on multi-GB working sets. Smaller buffers keep the default alignment so
+    // constants and scratch allocations are not padded up.
+    constexpr size_t large_page_size = 2 * 1024 * 1024;
+    const cl_uint alignment = _bytes_count >= large_page_size ? static_cast<cl_uint>(large_page_size) : 0;
     switch (get_allocation_type()) {
     case allocation_type::usm_host:
-        _buffer.allocateHost(_bytes_count);
+        _buffer.allocateHost(_bytes_count, alignment);
         break;
     case allocation_type::usm_shared:
-        _buffer.allocateShared(_bytes_count);
+        _buffer.allocateShared(_bytes_count, alignment);
         break;
     case allocation_type::usm_device:
-        _buffer.allocateDevice(_bytes_count);
+        _buffer.allocateDevice(_bytes_count, alignment);
         break;
     default:
         CLDNN_ERROR_MESSAGE("gpu_usm allocation type",
@@ -75,6 +75,7 @@ inline void update_output_tensors(ov::TensorVector& output_values, const ngraph:
 class TemporaryOverrideOutputs {
     std::shared_ptr<ov::Model> model;
     std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::PartialShape> orig_paramter_shapes_map;
+    bool shapes_changed = false;
 
 public:
     TemporaryOverrideOutputs(std::shared_ptr<ov::Model>& model,
@@ -83,12 +84,21 @@ public:
         for (const auto& param : model->get_parameters()) {
             auto output_tensor = param->output(0).get_tensor_ptr();
             orig_paramter_shapes_map.insert({output_tensor, param->get_partial_shape()});
-            param->set_partial_shape(tensor_map.at(output_tensor).get_shape());
+            ov::PartialShape input_shape = tensor_map.at(output_tensor).get_shape();
+            if (param->get_partial_shape() != input_shape) {
+                param->set_partial_shape(input_shape);
+                shapes_changed = true;
+            }
         }
-        model->validate_nodes_and_infer_types();
+        // Re-validation is only needed when an input shape differs from the declared parameter
+        // shape, so fully static models skip the whole pass on every call.
+        if (shapes_changed)
+            model->validate_nodes_and_infer_types();
     }
 
     ~TemporaryOverrideOutputs() {
+        if (!shapes_changed)
+            return;
         for (const auto& param : model->get_parameters()) {
             auto output_tensor = param->output(0).get_tensor_ptr();
             param->set_partial_shape(orig_paramter_shapes_map.at(output_tensor));
@@ -99,8 +109,12 @@ public:
 
 ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov::Model>& model) : m_is_compiled{true} {
     m_model = model->clone();
+    auto& evaluators_map = ngraph::runtime::interpreter::get_evaluators_map();
     for (auto node : m_model->get_ordered_ops()) {
         m_nodes.push_back(node);
+        auto it = evaluators_map.find(node->get_type_info());
+        if (it != evaluators_map.end())
+            m_evaluators.emplace(node.get(), it->second);
     }
     set_parameters_and_results(*m_model);
 }
@@ -183,10 +197,24 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
             auto it = tensor_map.find(tensor);
             auto output = op->output(i);
             if (op::util::is_output(op) || it == tensor_map.end() || !it->second) {
-                host_tensor = ov::Tensor(output.get_element_type(),
-                                         output.get_partial_shape().is_dynamic()
-                                             ? ov::Shape{0, std::numeric_limits<size_t>::max()}
-                                             : output.get_shape());
+                if (output.get_partial_shape().is_dynamic()) {
+                    host_tensor = ov::Tensor(output.get_element_type(), ov::Shape{0, std::numeric_limits<size_t>::max()});
+                } else if (!op::util::is_output(op)) {
+                    // Reuse the buffer allocated for this output on a previous call while its type
+                    // and shape are stable. Graph outputs are not cached: they may escape to the
+                    // caller through the outputs vector below.
+                    auto cached = m_cached_outputs.find(tensor);
+                    if (cached != m_cached_outputs.end() &&
+                        cached->second.get_element_type() == output.get_element_type() &&
+                        cached->second.get_shape() == output.get_shape()) {
+                        host_tensor = cached->second;
+                    } else {
+                        host_tensor = ov::Tensor(output.get_element_type(), output.get_shape());
+                        m_cached_outputs[tensor] = host_tensor;
+                    }
+                } else {
+                    host_tensor = ov::Tensor(output.get_element_type(), output.get_shape());
+                }
             } else {
                 host_tensor = it->second;
             }
@@ -267,12 +295,11 @@ std::vector<ov::Tensor> ov::runtime::interpreter::INTExecutable::create_output_t
 bool ov::runtime::interpreter::INTExecutable::evaluate_node(const std::shared_ptr<Node>& node,
                                                             ov::TensorVector& outputs,
                                                             const ov::TensorVector& inputs) const {
-    auto& map = ngraph::runtime::interpreter::get_evaluators_map();
-    auto it = map.find(node->get_type_info());
+    auto it = m_evaluators.find(node.get());
     bool res = false;
     const auto tensor_inputs = create_tmp_tensors(inputs);
     auto tensor_outputs = create_tmp_tensors(outputs);
-    OPENVINO_ASSERT(it != map.end(),
+    OPENVINO_ASSERT(it != m_evaluators.end(),
                     "Interpreter backend doesn't implement evaluate method for OP ",
                     node->get_type_info().name);
     res = it->second(node, tensor_outputs, tensor_inputs);
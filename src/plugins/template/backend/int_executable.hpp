@@ -9,9 +9,11 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "backend.hpp"
+#include "evaluates_map.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/op/non_max_suppression.hpp"
 #include "openvino/op/parameter.hpp"
@@ -57,6 +59,13 @@ protected:
     bool m_is_compiled = false;
     std::shared_ptr<ov::Model> m_model;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    // Evaluators resolved once at compile time; nodes without an entry fall back to the map lookup
+    // in evaluate_node, which reports the missing implementation.
+    std::unordered_map<const ov::Node*, ngraph::runtime::interpreter::EvaluatorsMap::mapped_type> m_evaluators;
+    // Intermediate output buffers kept between calls; an entry is reused as long as the producing
+    // output keeps its element type and static shape. One executable serves one infer request,
+    // so calls never overlap.
+    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::Tensor> m_cached_outputs;
     std::atomic_bool m_cancel_execution{false};
     std::mutex m_mutex;
 
@@ -6,7 +6,10 @@
 #include <iostream>
 #include <fstream>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <map>
 #include <vector>
@@ -78,6 +81,14 @@ static constexpr char api1_message[] =
                                              "Optional. Compile model to legacy format for usage in Inference Engine API,\n"
 "                                             by default compiles to OV 2.0 API";
 
+static constexpr char model_list_message[] =
+                                             "Optional. Path to a text file listing models to compile, one per line:\n"
+"                                             \"<model_xml> [<output_blob>]\". All models are compiled with one ov::Core\n"
+"                                             and share the device and precision/layout options. Can't be combined with -m.";
+
+static constexpr char jobs_message[] =
+                                             "Optional. Number of models compiled in parallel in -mlist mode. Default value: 1.";
+
 DEFINE_bool(h, false, help_message);
 DEFINE_string(m, "", model_message);
 DEFINE_string(d, "", targetDeviceMessage);
@@ -94,6 +105,8 @@ DEFINE_string(iml, "", inputs_model_layout_message);
 DEFINE_string(oml, "", outputs_model_layout_message);
 DEFINE_string(ioml, "", ioml_message);
 DEFINE_bool(ov_api_1_0, false, api1_message);
+DEFINE_string(mlist, "", model_list_message);
+DEFINE_int32(j, 1, jobs_message);
 
 namespace {
 std::vector<std::string> splitStringList(const std::string& str, char delim) {
@@ -553,6 +566,8 @@ static void showUsage() {
     std::cout << "    -oml                         <value>     "   << outputs_model_layout_message << std::endl;
     std::cout << "    -ioml                       \"<value>\"    "   << ioml_message               << std::endl;
     std::cout << "    -ov_api_1_0                              "   << api1_message                 << std::endl;
+    std::cout << "    -mlist                       <value>     "   << model_list_message           << std::endl;
+    std::cout << "    -j                           <value>     "   << jobs_message                 << std::endl;
     std::cout << std::endl;
 }
 
@@ -564,8 +579,16 @@ static bool parseCommandLine(int* argc, char*** argv) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
-        throw std::invalid_argument("Path to model xml file is required");
+    if (FLAGS_m.empty() == FLAGS_mlist.empty()) {
+        throw std::invalid_argument("Path to model xml file (-m) or to a model list file (-mlist) is required");
+    }
+
+    if (!FLAGS_mlist.empty() && FLAGS_ov_api_1_0) {
+        throw std::invalid_argument("-mlist is not supported together with -ov_api_1_0");
+    }
+
+    if (FLAGS_j < 1) {
+        throw std::invalid_argument("Number of parallel compilations (-j) must be positive");
     }
 
     if (FLAGS_d.empty()) {
@@ -654,6 +677,31 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+static TimeDiff compileAndExport(ov::Core& core,
+                                 const std::string& modelPath,
+                                 const std::string& outputName,
+                                 const std::map<std::string, std::string>& configs,
+                                 bool printModelInfo) {
+    auto model = core.read_model(modelPath);
+
+    configurePrePostProcessing(model, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
+    if (printModelInfo) {
+        printInputAndOutputsInfoShort(*model);
+    }
+
+    auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
+    auto compiledModel = core.compile_model(model, FLAGS_d, {configs.begin(), configs.end()});
+    auto elapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
+
+    auto output = outputName.empty() ? getFileNameFromPath(fileNameNoExt(modelPath)) + ".blob" : outputName;
+    std::ofstream outputFile{output, std::ios::out | std::ios::binary};
+    if (!outputFile.is_open()) {
+        throw std::runtime_error("Output file " + output + " can't be opened for writing");
+    }
+    compiledModel.export_model(outputFile);
+    return elapsed;
+}
+
 int main(int argc, char* argv[]) {
     TimeDiff loadNetworkTimeElapsed {0};
 
@@ -698,34 +746,75 @@ int main(int argc, char* argv[]) {
             } else {
                 executableNetwork.Export(outputFile);
             }
-        } else {
+        } else if (!FLAGS_mlist.empty()) {
+            std::ifstream listFile(FLAGS_mlist);
+            if (!listFile.is_open()) {
+                std::cerr << "Model list file " << FLAGS_mlist << " can't be opened" << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            std::vector<std::pair<std::string, std::string>> jobs;
+            std::string line;
+            while (std::getline(listFile, line)) {
+                std::istringstream fields(line);
+                std::string modelPath, outputName;
+                fields >> modelPath >> outputName;
+                if (modelPath.empty() || modelPath[0] == '#') {
+                    continue;
+                }
+                jobs.emplace_back(std::move(modelPath), std::move(outputName));
+            }
+
+            // One Core for the whole manifest: plugins are loaded once and stay hot
+            // for every compilation instead of being paid per tool invocation
             ov::Core core;
             if (!FLAGS_log_level.empty()) {
                 ov::log::Level level;
                 std::stringstream{FLAGS_log_level} >> level;
                 core.set_property(FLAGS_d, ov::log::level(level));
             }
+            auto configs = parseConfigFile();
 
-            auto model = core.read_model(FLAGS_m);
+            std::atomic<size_t> nextJob{0};
+            std::atomic<bool> anyFailed{false};
+            std::mutex logMutex;
+            auto worker = [&]() {
+                for (size_t i = nextJob++; i < jobs.size(); i = nextJob++) {
+                    try {
+                        auto elapsed = compileAndExport(core, jobs[i].first, jobs[i].second, configs, false);
+                        std::lock_guard<std::mutex> lock(logMutex);
+                        loadNetworkTimeElapsed += elapsed;
+                        std::cout << jobs[i].first << ": compiled in " << elapsed.count() << " ms" << std::endl;
+                    } catch (const std::exception& error) {
+                        anyFailed = true;
+                        std::lock_guard<std::mutex> lock(logMutex);
+                        std::cerr << jobs[i].first << ": " << error.what() << std::endl;
+                    }
+                }
+            };
 
-            configurePrePostProcessing(model, FLAGS_ip, FLAGS_op, FLAGS_iop, FLAGS_il, FLAGS_ol, FLAGS_iol, FLAGS_iml, FLAGS_oml, FLAGS_ioml);
-            printInputAndOutputsInfoShort(*model);
-            auto timeBeforeLoadNetwork = std::chrono::steady_clock::now();
-            auto configs = parseConfigFile();
-            auto compiledModel = core.compile_model(model, FLAGS_d, {configs.begin(), configs.end()});
-            loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
-            std::string outputName = FLAGS_o;
-            if (outputName.empty()) {
-                outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
+            std::vector<std::thread> pool;
+            const auto numWorkers = std::min(static_cast<size_t>(FLAGS_j), jobs.size());
+            for (size_t i = 0; i < numWorkers; i++) {
+                pool.emplace_back(worker);
+            }
+            for (auto& thread : pool) {
+                thread.join();
             }
 
-            std::ofstream outputFile{outputName, std::ios::out | std::ios::binary};
-            if (!outputFile.is_open()) {
-                std::cout << "Output file " << outputName << " can't be opened for writing" << std::endl;
+            if (anyFailed) {
                 return EXIT_FAILURE;
-            } else {
-                compiledModel.export_model(outputFile);
             }
+        } else {
+            ov::Core core;
+            if (!FLAGS_log_level.empty()) {
+                ov::log::Level level;
+                std::stringstream{FLAGS_log_level} >> level;
+                core.set_property(FLAGS_d, ov::log::level(level));
+            }
+
+            auto configs = parseConfigFile();
+            loadNetworkTimeElapsed = compileAndExport(core, FLAGS_m, FLAGS_o, configs, true);
         }
     } catch (const std::exception& error) {
         std::cerr << error.what() << std::endl;